@@ -0,0 +1,90 @@
+// header files
+#include "Arena.h"
+
+/*
+ * Function Name: arenaAlloc
+ * Algorithm: rounds request up to the arena alignment and bumps the head
+ *            block, starting a new block when the request does not fit
+ * Precondition: given initialized arena and size in bytes
+ * Postcondition: aligned storage returned, valid until clearArena
+ * Exceptions: none
+ * Notes: requests larger than the block size get a block of their own
+ */
+void *arenaAlloc(Arena *arenaPtr, size_t size)
+   {
+    // initialize function/variables
+    ArenaBlock *blockPtr = arenaPtr->headPtr;
+    size_t headerSize = arenaAlign(sizeof(ArenaBlock));
+    size_t capacity;
+    void *dataPtr;
+
+    // round request up to alignment
+    size = arenaAlign(size);
+
+    // start new block when head block is missing or full
+    if (blockPtr == NULL || blockPtr->used + size > blockPtr->capacity)
+       {
+        capacity = size > arenaPtr->blockSize ? size : arenaPtr->blockSize;
+        blockPtr = (ArenaBlock*)malloc(headerSize + capacity);
+        blockPtr->used = 0;
+        blockPtr->capacity = capacity;
+        blockPtr->nextBlock = arenaPtr->headPtr;
+        arenaPtr->headPtr = blockPtr;
+       }
+
+    // carve request from block
+    dataPtr = (char*)blockPtr + headerSize + blockPtr->used;
+    blockPtr->used += size;
+
+    // return storage
+    return dataPtr;
+   }
+
+/*
+ * Function Name: arenaAlign
+ * Algorithm: rounds a size up to the next multiple of the arena alignment
+ * Precondition: given size in bytes
+ * Postcondition: aligned size returned
+ * Exceptions: none
+ * Notes: none
+ */
+size_t arenaAlign(size_t size)
+   {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+   }
+
+/*
+ * Function Name: clearArena
+ * Algorithm: walks the block list and returns every block to OS
+ * Precondition: given initialized arena
+ * Postcondition: arena empty, all storage from it released
+ * Exceptions: none
+ * Notes: arena may be reused after clearing
+ */
+void clearArena(Arena *arenaPtr)
+   {
+    // initialize function/variables
+    ArenaBlock *blockPtr;
+
+    // release each block
+    while (arenaPtr->headPtr != NULL)
+       {
+        blockPtr = arenaPtr->headPtr;
+        arenaPtr->headPtr = blockPtr->nextBlock;
+        free(blockPtr);
+       }
+   }
+
+/*
+ * Function Name: initArena
+ * Algorithm: sets arena to empty with the given block size
+ * Precondition: given arena storage and block size, zero for default
+ * Postcondition: arena ready for use
+ * Exceptions: none
+ * Notes: first block is allocated on first request
+ */
+void initArena(Arena *arenaPtr, size_t blockSize)
+   {
+    arenaPtr->headPtr = NULL;
+    arenaPtr->blockSize = blockSize > 0 ? blockSize : DEFAULT_ARENA_BLOCK;
+   }
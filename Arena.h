@@ -0,0 +1,34 @@
+// Preprocessor directive
+#ifndef ARENA_H
+#define ARENA_H
+
+// header files
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// global constants
+#define ARENA_ALIGN 16
+#define DEFAULT_ARENA_BLOCK 65536
+
+// block header; block data follows the header in the same allocation
+typedef struct ArenaBlock
+   {
+    struct ArenaBlock *nextBlock;
+    size_t used;
+    size_t capacity;
+   } ArenaBlock;
+
+// bump allocator; everything allocated from it is released together
+typedef struct Arena
+   {
+    ArenaBlock *headPtr;
+    size_t blockSize;
+   } Arena;
+
+// function prototypes
+void *arenaAlloc(Arena *arenaPtr, size_t size);
+size_t arenaAlign(size_t size);
+void clearArena(Arena *arenaPtr);
+void initArena(Arena *arenaPtr, size_t blockSize);
+
+#endif // ARENA_H
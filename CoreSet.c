@@ -0,0 +1,232 @@
+// header files
+#include "CoreSet.h"
+
+/*
+ * Function Name: clearCoreSet
+ * Algorithm: releases every core ready queue, then the queue array and
+ *            wake objects
+ * Precondition: given initialized core set with no core waiting
+ * Postcondition: core set memory returned to OS
+ * Exceptions: none
+ * Notes: none
+ */
+void clearCoreSet(CoreSet *coreSetPtr)
+   {
+    // initialize function/variables
+    int coreId;
+
+    // release each core queue
+    for (coreId = 0; coreId < coreSetPtr->numCores; coreId++)
+       {
+        clearReadyQueue(&coreSetPtr->queues[ coreId ]);
+       }
+
+    // release queue array and wake objects
+    free(coreSetPtr->queues);
+    coreSetPtr->queues = NULL;
+    pthread_cond_destroy(&coreSetPtr->workAvailable);
+    pthread_mutex_destroy(&coreSetPtr->wakeLock);
+   }
+
+/*
+ * Function Name: initCoreSet
+ * Algorithm: creates one empty ready queue per core and initializes the
+ *            wake lock and condition
+ * Precondition: given core set storage, number of cores, flag selecting
+ *               heap order for every queue, and number of priority levels
+ *               for FIFO queues
+ * Postcondition: core set ready for use, no active processes
+ * Exceptions: none
+ * Notes: core count is clamped to 1 through MAX_SIM_CORES
+ */
+void initCoreSet(CoreSet *coreSetPtr, int numCores, Boolean heapOrder,
+                                                              int numLevels)
+   {
+    // initialize function/variables
+    int coreId;
+
+    // clamp core count
+    if (numCores < 1)
+       {
+        numCores = 1;
+       }
+    else if (numCores > MAX_SIM_CORES)
+       {
+        numCores = MAX_SIM_CORES;
+       }
+
+    // create core queues
+    coreSetPtr->queues = (ReadyQueue*)malloc(sizeof(ReadyQueue) * numCores);
+    for (coreId = 0; coreId < numCores; coreId++)
+       {
+        initReadyQueue(&coreSetPtr->queues[ coreId ], heapOrder, numLevels);
+       }
+    coreSetPtr->numCores = numCores;
+    coreSetPtr->activeCount = 0;
+
+    // initialize wake objects
+    pthread_mutex_init(&coreSetPtr->wakeLock, NULL);
+    pthread_cond_init(&coreSetPtr->workAvailable, NULL);
+    coreSetPtr->wakeCount = 0;
+   }
+
+/*
+ * Function Name: popCoreReady
+ * Algorithm: takes the next entry from the core's own queue; if it is
+ *            empty, visits the other cores in turn starting with the next
+ *            one and steals the next entry from the first non-empty queue
+ * Precondition: given core set, core id, and storage for the id of the
+ *               core the entry came from
+ * Postcondition: entry returned with its source core set, or NULL if every
+ *                queue is empty
+ * Exceptions: none
+ * Notes: caller serializes access to the queues
+ */
+void *popCoreReady(CoreSet *coreSetPtr, int coreId, int *fromCorePtr)
+   {
+    // initialize function/variables
+    int offset, victim;
+    void *dataPtr;
+
+    // search own queue first, then each other core in turn
+    for (offset = 0; offset < coreSetPtr->numCores; offset++)
+       {
+        victim = (coreId + offset) % coreSetPtr->numCores;
+        dataPtr = popReady(&coreSetPtr->queues[ victim ]);
+
+        if (dataPtr != NULL)
+           {
+            *fromCorePtr = victim;
+            return dataPtr;
+           }
+       }
+
+    // nothing ready on any core
+    return NULL;
+   }
+
+/*
+ * Function Name: pushCoreReady
+ * Algorithm: adds entry to the given core's queue and wakes idle cores so
+ *            they may steal it
+ * Precondition: given core set, core id, entry data, and sort key
+ * Postcondition: entry queued on core
+ * Exceptions: none
+ * Notes: caller serializes access to the queues
+ */
+void pushCoreReady(CoreSet *coreSetPtr, int coreId, void *dataPtr,
+                                                              double sortKey)
+   {
+    pushReady(&coreSetPtr->queues[ coreId ], dataPtr, sortKey);
+
+    // only other cores can be idle
+    if (coreSetPtr->numCores > 1)
+       {
+        wakeCores(coreSetPtr);
+       }
+   }
+
+/*
+ * Function Name: raiseCoreLevels
+ * Algorithm: moves every core's lower priority entries to its top level
+ * Precondition: given core set
+ * Postcondition: every queued entry at its core's top level; number moved
+ *                returned
+ * Exceptions: none
+ * Notes: caller serializes access to the queues; entries stay on their
+ *        own cores
+ */
+int raiseCoreLevels(CoreSet *coreSetPtr)
+   {
+    // initialize function/variables
+    int coreId, numMoved = 0;
+
+    // raise each core queue
+    for (coreId = 0; coreId < coreSetPtr->numCores; coreId++)
+       {
+        numMoved += raiseReadyLevels(&coreSetPtr->queues[ coreId ]);
+       }
+
+    // return count moved
+    return numMoved;
+   }
+
+/*
+ * Function Name: readWakeCount
+ * Algorithm: reads the wake count under the wake lock
+ * Precondition: given initialized core set
+ * Postcondition: current wake count returned
+ * Exceptions: none
+ * Notes: read before checking for work, then pass to waitForCoreWork, so
+ *        work arriving between the check and the wait is not missed
+ */
+long readWakeCount(CoreSet *coreSetPtr)
+   {
+    // initialize function/variables
+    long wakeCount;
+
+    // read count under lock
+    pthread_mutex_lock(&coreSetPtr->wakeLock);
+    wakeCount = coreSetPtr->wakeCount;
+    pthread_mutex_unlock(&coreSetPtr->wakeLock);
+
+    // return count
+    return wakeCount;
+   }
+
+/*
+ * Function Name: topCoreLevel
+ * Algorithm: finds the highest priority level holding entries in the
+ *            given core's queue
+ * Precondition: given core set and core id
+ * Postcondition: level returned, 0 highest, or the number of levels if
+ *                the core's queue is empty
+ * Exceptions: none
+ * Notes: caller serializes access to the queues; other cores' queues are
+ *        not searched
+ */
+int topCoreLevel(CoreSet *coreSetPtr, int coreId)
+   {
+    return topReadyLevel(&coreSetPtr->queues[ coreId ]);
+   }
+
+/*
+ * Function Name: waitForCoreWork
+ * Algorithm: sleeps on the work condition until the wake count differs
+ *            from the one read before the caller last looked for work
+ * Precondition: given core set and previously read wake count
+ * Postcondition: returns once something may have changed
+ * Exceptions: none
+ * Notes: caller must not hold any lock that wakers take
+ */
+void waitForCoreWork(CoreSet *coreSetPtr, long wakeCount)
+   {
+    pthread_mutex_lock(&coreSetPtr->wakeLock);
+    while (coreSetPtr->wakeCount == wakeCount)
+       {
+        pthread_cond_wait(&coreSetPtr->workAvailable, &coreSetPtr->wakeLock);
+       }
+    pthread_mutex_unlock(&coreSetPtr->wakeLock);
+   }
+
+/*
+ * Function Name: wakeCores
+ * Algorithm: bumps the wake count and wakes every sleeping core
+ * Precondition: given core set
+ * Postcondition: idle cores will look for work again
+ * Exceptions: none
+ * Notes: matches the job function signature so the interrupt queue can
+ *        call it when a device raises an interrupt
+ */
+void *wakeCores(void *coreSetPtr)
+   {
+    // initialize function/variables
+    CoreSet *coreSet = coreSetPtr;
+
+    // bump count and wake sleepers
+    pthread_mutex_lock(&coreSet->wakeLock);
+    coreSet->wakeCount++;
+    pthread_cond_broadcast(&coreSet->workAvailable);
+    pthread_mutex_unlock(&coreSet->wakeLock);
+    return NULL;
+   }
@@ -0,0 +1,41 @@
+// Preprocessor directive
+#ifndef CORE_SET_H
+#define CORE_SET_H
+
+// header files
+#include <stdlib.h>
+#include <pthread.h>
+#include "StringUtils.h"
+#include "ReadyQueue.h"
+
+// global constants
+#define MAX_SIM_CORES 64
+
+// simulated cpus, each with its own ready queue; a core with an empty
+// queue steals from the others, and a core with nothing to steal sleeps
+// until the wake count changes; activeCount tracks every process not yet
+// in EXIT so completion is checked without a scan
+typedef struct CoreSet
+   {
+    ReadyQueue *queues;
+    int numCores;
+    int activeCount;
+    pthread_mutex_t wakeLock;
+    pthread_cond_t workAvailable;
+    long wakeCount;
+   } CoreSet;
+
+// function prototypes
+void clearCoreSet(CoreSet *coreSetPtr);
+void initCoreSet(CoreSet *coreSetPtr, int numCores, Boolean heapOrder,
+                                                             int numLevels);
+void *popCoreReady(CoreSet *coreSetPtr, int coreId, int *fromCorePtr);
+void pushCoreReady(CoreSet *coreSetPtr, int coreId, void *dataPtr,
+                                                             double sortKey);
+int raiseCoreLevels(CoreSet *coreSetPtr);
+long readWakeCount(CoreSet *coreSetPtr);
+int topCoreLevel(CoreSet *coreSetPtr, int coreId);
+void waitForCoreWork(CoreSet *coreSetPtr, long wakeCount);
+void *wakeCores(void *coreSetPtr);
+
+#endif // CORE_SET_H
@@ -0,0 +1,518 @@
+// header files
+#include "DeviceSet.h"
+
+// request order names, in IoSchedCode order
+static const char *ioSchedNames[] =
+   {
+    "None",
+    "FIFO",
+    "SSTF",
+    "SCAN"
+   };
+
+/*
+ * Function Name: clearDeviceSet
+ * Algorithm: releases any requests still waiting, then each device's
+ *            synchronization objects and the device array
+ * Precondition: given initialized set with its devices stopped
+ * Postcondition: set emptied and released
+ * Exceptions: none
+ * Notes: none
+ */
+void clearDeviceSet(DeviceSet *setPtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr;
+    IoRequest *requestPtr;
+    int index;
+
+    // release each device's waiting requests and locks
+    for (index = 0; index < setPtr->numDevices; index++)
+       {
+        devicePtr = &setPtr->devices[ index ];
+        while (devicePtr->headPtr != NULL)
+           {
+            requestPtr = devicePtr->headPtr;
+            devicePtr->headPtr = requestPtr->nextNode;
+            free(requestPtr);
+           }
+        pthread_cond_destroy(&devicePtr->requestQueued);
+        pthread_mutex_destroy(&devicePtr->deviceLock);
+       }
+
+    // release device array
+    free(setPtr->devices);
+    setPtr->devices = NULL;
+    setPtr->numDevices = 0;
+   }
+
+/*
+ * Function Name: completeDeviceIo
+ * Algorithm: in virtual clock mode, frees the finished request's device
+ *            and starts its next waiting request once both the device is
+ *            free and the request was queued, recording that completion
+ * Precondition: given device set and completed device request taken from
+ *               the interrupt queue
+ * Postcondition: device idle or serving its next request
+ * Exceptions: none
+ * Notes: in real time mode each device's service job moves on by itself,
+ *        so nothing is done
+ */
+void completeDeviceIo(DeviceSet *setPtr, IoRequest *requestPtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr = &setPtr->devices[ requestPtr->deviceId ];
+    IoRequest *nextPtr;
+    double startTime;
+
+    // check for real time mode
+    if (setPtr->queuePtr->clockPtr->virtualMode == False)
+       {
+        return;
+       }
+
+    // free device, then start next request, if any waiting
+    devicePtr->busy = False;
+    if (devicePtr->headPtr != NULL)
+       {
+        nextPtr = pickDeviceRequest(devicePtr, setPtr->schedCode);
+        startTime = devicePtr->freeTime > nextPtr->queuedTime
+                                 ? devicePtr->freeTime : nextPtr->queuedTime;
+        updateDepth(devicePtr, startTime, -1);
+        startDeviceIo(devicePtr, nextPtr, startTime);
+        pushEvent(&setPtr->queuePtr->pendingIo, devicePtr->freeTime,
+                                                                    nextPtr);
+       }
+   }
+
+/*
+ * Function Name: deviceService
+ * Algorithm: worker pool job serving one device in real time mode; waits
+ *            for requests, takes each in the set's order, runs its
+ *            service time, then raises its interrupt
+ * Precondition: given device of a started set
+ * Postcondition: requests served until the device is stopped
+ * Exceptions: none
+ * Notes: a request is not touched once its interrupt is raised, since
+ *        the dispatcher frees it
+ */
+void *deviceService(void *devicePtr)
+   {
+    // initialize function/variables
+    IoDevice *device = devicePtr;
+    DeviceSet *setPtr = device->setPtr;
+    SimClock *clockPtr = setPtr->queuePtr->clockPtr;
+    IoRequest *requestPtr;
+    int serviceTime;
+
+    // serve requests until stopped
+    pthread_mutex_lock(&device->deviceLock);
+    while (device->stopFlag == False)
+       {
+        // wait for a request or stop
+        while (device->stopFlag == False && device->headPtr == NULL)
+           {
+            pthread_cond_wait(&device->requestQueued, &device->deviceLock);
+           }
+
+        // take next request and run it outside of lock
+        if (device->headPtr != NULL)
+           {
+            requestPtr = pickDeviceRequest(device, setPtr->schedCode);
+            updateDepth(device, readRealClock(clockPtr), -1);
+            serviceTime = startDeviceIo(device, requestPtr,
+                                                   readRealClock(clockPtr));
+            pthread_mutex_unlock(&device->deviceLock);
+            runTimer(serviceTime);
+
+            // free device before its completion is seen
+            pthread_mutex_lock(&device->deviceLock);
+            device->busy = False;
+            pthread_mutex_unlock(&device->deviceLock);
+            raiseInterrupt(setPtr->queuePtr, requestPtr);
+            pthread_mutex_lock(&device->deviceLock);
+           }
+       }
+    pthread_mutex_unlock(&device->deviceLock);
+
+    return NULL;
+   }
+
+/*
+ * Function Name: initDeviceSet
+ * Algorithm: allocates one idle device per program device, each with its
+ *            head at track 0 sweeping up and its counters cleared
+ * Precondition: given set storage, program device names and count,
+ *               request order code, full-stroke seek time in ms, and the
+ *               interrupt queue completions are raised on
+ * Postcondition: set ready for use, devices not yet started
+ * Exceptions: none
+ * Notes: device names are referenced, not copied, so they must outlive
+ *        the set
+ */
+void initDeviceSet(DeviceSet *setPtr, char (*deviceNames)[ STD_STR_LEN ],
+                      int numDevices, int schedCode, int seekTime,
+                                                    InterruptQueue *queuePtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr;
+    int index;
+
+    // set shared settings
+    setPtr->devices = (IoDevice*)calloc(numDevices, sizeof(IoDevice));
+    setPtr->numDevices = numDevices;
+    setPtr->schedCode = schedCode;
+    setPtr->seekTime = seekTime;
+    setPtr->started = False;
+    setPtr->queuePtr = queuePtr;
+
+    // set each device idle with head at first track
+    for (index = 0; index < numDevices; index++)
+       {
+        devicePtr = &setPtr->devices[ index ];
+        devicePtr->deviceName = deviceNames[ index ];
+        devicePtr->sweepUp = True;
+        pthread_mutex_init(&devicePtr->deviceLock, NULL);
+        pthread_cond_init(&devicePtr->requestQueued, NULL);
+        devicePtr->setPtr = setPtr;
+       }
+   }
+
+/*
+ * Function Name: logDeviceReport
+ * Algorithm: writes the request order in use and one row per device of
+ *            its requests served, utilization and average queue depth
+ *            over the makespan, maximum queue depth, average wait for the
+ *            device, and tracks moved, through the simulator log's text
+ *            sinks
+ * Precondition: given opened log, device set after the run, and the
+ *               run's makespan in seconds
+ * Postcondition: report displayed and/or logged as configured
+ * Exceptions: none
+ * Notes: queue depth and wait count only requests waiting, not the one
+ *        being served
+ */
+void logDeviceReport(SimLog *logPtr, DeviceSet *setPtr, double makespan)
+   {
+    // initialize function/variables
+    char lineStr[ MAX_EVENT_LINE_LEN ];
+    IoDevice *devicePtr;
+    double utilization, avgDepth, avgWait;
+    int index;
+
+    // display heading
+    logText(logPtr, "\nEnd of Run Device Queues (seconds)\n");
+    logText(logPtr, "----------------------------------\n");
+    sprintf(lineStr, "Request order: %s, full-stroke seek %d ms\n",
+                        ioSchedNames[ setPtr->schedCode ], setPtr->seekTime);
+    logText(logPtr, lineStr);
+    sprintf(lineStr, "%-16s %9s %8s %10s %10s %10s %12s\n", "Device",
+                  "Requests", "Util", "Avg Depth", "Max Depth", "Avg Wait",
+                                                            "Tracks Moved");
+    logText(logPtr, lineStr);
+
+    // display one row per device
+    for (index = 0; index < setPtr->numDevices; index++)
+       {
+        devicePtr = &setPtr->devices[ index ];
+        utilization = 0.0;
+        avgDepth = 0.0;
+        avgWait = 0.0;
+        if (makespan > 0.0)
+           {
+            utilization = devicePtr->busyTime / makespan;
+            avgDepth = devicePtr->depthArea / makespan;
+           }
+        if (devicePtr->numRequests > 0)
+           {
+            avgWait = devicePtr->queueWaitTime / devicePtr->numRequests;
+           }
+        sprintf(lineStr, "%-16s %9ld %7.2f%% %10.3f %10d %10.6f %12ld\n",
+                 devicePtr->deviceName, devicePtr->numRequests,
+                 utilization * PERCENT, avgDepth, devicePtr->maxDepth,
+                                          avgWait, devicePtr->tracksMoved);
+        logText(logPtr, lineStr);
+       }
+   }
+
+/*
+ * Function Name: pickDeviceRequest
+ * Algorithm: unlinks the device's next request: the oldest for FIFO, the
+ *            nearest the head for SSTF, and for SCAN the nearest in the
+ *            sweep direction, reversing the sweep when none lies ahead
+ * Precondition: given device with at least one waiting request, and
+ *               request order code
+ * Postcondition: chosen request removed from device queue and returned
+ * Exceptions: none
+ * Notes: equal distances go to the older request; the SCAN sweep turns at
+ *        the last request rather than the disk edge, as LOOK does
+ */
+IoRequest *pickDeviceRequest(IoDevice *devicePtr, int schedCode)
+   {
+    // initialize function/variables
+    IoRequest *requestPtr = devicePtr->headPtr, *bestPtr = requestPtr;
+    IoRequest *prevPtr = NULL, *bestPrevPtr = NULL;
+    int distance, bestDistance = INT_MAX;
+
+    // find nearest request, ranking those behind a SCAN sweep after all
+    // those ahead of it
+    while (schedCode != IO_SCHED_FIFO_CODE && requestPtr != NULL)
+       {
+        distance = requestPtr->trackNum - devicePtr->headTrack;
+        if (schedCode == IO_SCHED_SCAN_CODE
+            && ((devicePtr->sweepUp == True && distance < 0)
+                || (devicePtr->sweepUp == False && distance > 0)))
+           {
+            distance = abs(distance) + DEVICE_TRACKS;
+           }
+        else
+           {
+            distance = abs(distance);
+           }
+        if (distance < bestDistance)
+           {
+            bestPtr = requestPtr;
+            bestPrevPtr = prevPtr;
+            bestDistance = distance;
+           }
+        prevPtr = requestPtr;
+        requestPtr = requestPtr->nextNode;
+       }
+
+    // reverse sweep when chosen request lies behind it
+    if (schedCode == IO_SCHED_SCAN_CODE && bestDistance > DEVICE_TRACKS)
+       {
+        devicePtr->sweepUp = devicePtr->sweepUp == True ? False : True;
+       }
+
+    // unlink chosen request
+    if (bestPrevPtr == NULL)
+       {
+        devicePtr->headPtr = bestPtr->nextNode;
+       }
+    else
+       {
+        bestPrevPtr->nextNode = bestPtr->nextNode;
+       }
+    if (devicePtr->tailPtr == bestPtr)
+       {
+        devicePtr->tailPtr = bestPrevPtr;
+       }
+    bestPtr->nextNode = NULL;
+
+    // return chosen request
+    return bestPtr;
+   }
+
+/*
+ * Function Name: requestTrack
+ * Algorithm: takes the track from the op's second number when given,
+ *            otherwise spreads ops across the tracks by op number
+ * Precondition: given op's second number, NO_TRACK when absent, and op
+ *               number
+ * Postcondition: track from 0 to DEVICE_TRACKS - 1 returned
+ * Exceptions: none
+ * Notes: an explicit track 0 is kept; the fallback is fixed per op, so
+ *        runs of one program repeat
+ */
+int requestTrack(int trackArg, int opIndex)
+   {
+    // check for track given in meta data
+    if (trackArg != NO_TRACK)
+       {
+        return trackArg % DEVICE_TRACKS;
+       }
+
+    // spread by op number
+    return (int)((long)opIndex * DEVICE_TRACK_STRIDE % DEVICE_TRACKS);
+   }
+
+/*
+ * Function Name: startDeviceIo
+ * Algorithm: marks the device busy with the request, moving its head to
+ *            the request's track, and charges the request's wait, seek,
+ *            and service time to the device
+ * Precondition: given idle device, request taken from its queue or about
+ *               to bypass it, and start time in seconds
+ * Postcondition: device busy until its free time; service time in ms,
+ *                seek included, returned
+ * Exceptions: none
+ * Notes: seek takes the full-stroke seek time scaled by tracks moved,
+ *        rounded up to whole ms so any head movement costs time
+ */
+int startDeviceIo(IoDevice *devicePtr, IoRequest *requestPtr,
+                                                          double startTime)
+   {
+    // initialize function/variables
+    int distance = abs(requestPtr->trackNum - devicePtr->headTrack);
+    int serviceTime = requestPtr->ioTime
+             + (int)(((long)distance * devicePtr->setPtr->seekTime
+                                     + DEVICE_TRACKS - 1) / DEVICE_TRACKS);
+
+    // move head and mark device busy
+    devicePtr->headTrack = requestPtr->trackNum;
+    devicePtr->busy = True;
+    devicePtr->freeTime = timeAfter(startTime, serviceTime);
+
+    // charge request to device
+    devicePtr->numRequests++;
+    devicePtr->tracksMoved += distance;
+    devicePtr->busyTime += (double)serviceTime / MS_PER_SEC;
+    devicePtr->queueWaitTime += startTime - requestPtr->queuedTime;
+
+    // return service time
+    return serviceTime;
+   }
+
+/*
+ * Function Name: startDevices
+ * Algorithm: in real time mode, hands each device's service job to a pool
+ *            worker
+ * Precondition: given initialized set
+ * Postcondition: every device serving its queue
+ * Exceptions: none
+ * Notes: pool needs one worker per device beyond those for cpu ops;
+ *        virtual clock mode serves queues from completeDeviceIo instead
+ */
+void startDevices(DeviceSet *setPtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr;
+    int index;
+
+    // check for virtual clock mode
+    if (setPtr->queuePtr->clockPtr->virtualMode == True)
+       {
+        return;
+       }
+
+    // start one service job per device
+    for (index = 0; index < setPtr->numDevices; index++)
+       {
+        devicePtr = &setPtr->devices[ index ];
+        submitJob(setPtr->queuePtr->poolPtr, &devicePtr->serviceJob,
+                                                &deviceService, devicePtr);
+       }
+    setPtr->started = True;
+   }
+
+/*
+ * Function Name: stopDevices
+ * Algorithm: flags each device to stop, wakes it, and waits for its
+ *            service job to return
+ * Precondition: given set with no requests still outstanding
+ * Postcondition: no service job running
+ * Exceptions: none
+ * Notes: a set never started has nothing to stop
+ */
+void stopDevices(DeviceSet *setPtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr;
+    int index;
+
+    // check for devices not started
+    if (setPtr->started == False)
+       {
+        return;
+       }
+
+    // stop and wait for each service job
+    for (index = 0; index < setPtr->numDevices; index++)
+       {
+        devicePtr = &setPtr->devices[ index ];
+        pthread_mutex_lock(&devicePtr->deviceLock);
+        devicePtr->stopFlag = True;
+        pthread_cond_signal(&devicePtr->requestQueued);
+        pthread_mutex_unlock(&devicePtr->deviceLock);
+        waitForJob(setPtr->queuePtr->poolPtr, &devicePtr->serviceJob);
+       }
+    setPtr->started = False;
+   }
+
+/*
+ * Function Name: submitDeviceIo
+ * Algorithm: queues an I/O request on its device; in virtual clock mode a
+ *            request for an idle device starts at once with its completion
+ *            recorded, while in real time mode the device's service job is
+ *            woken to take it
+ * Precondition: given device set and new request with its device number
+ *               and track set
+ * Postcondition: request will surface from takeInterrupt once served;
+ *                number of requests ahead of it, the one being served
+ *                included, returned
+ * Exceptions: none
+ * Notes: real time requests are marked done as jobs, since the device's
+ *        service job runs them, so takeInterrupt does not wait on them
+ */
+int submitDeviceIo(DeviceSet *setPtr, IoRequest *requestPtr)
+   {
+    // initialize function/variables
+    IoDevice *devicePtr = &setPtr->devices[ requestPtr->deviceId ];
+    SimClock *clockPtr = setPtr->queuePtr->clockPtr;
+    int numAhead;
+
+    // check for idle device in virtual clock mode
+    requestPtr->nextNode = NULL;
+    requestPtr->job.jobDone = True;
+    if (clockPtr->virtualMode == True && devicePtr->busy == False)
+       {
+        requestPtr->queuedTime = clockPtr->currentTime;
+        startDeviceIo(devicePtr, requestPtr, clockPtr->currentTime);
+        pushEvent(&setPtr->queuePtr->pendingIo, devicePtr->freeTime,
+                                                                 requestPtr);
+        return 0;
+       }
+
+    // append to device queue tail
+    pthread_mutex_lock(&devicePtr->deviceLock);
+    requestPtr->queuedTime = clockPtr->virtualMode == True
+                          ? clockPtr->currentTime : readRealClock(clockPtr);
+    if (devicePtr->tailPtr == NULL)
+       {
+        devicePtr->headPtr = requestPtr;
+       }
+    else
+       {
+        devicePtr->tailPtr->nextNode = requestPtr;
+       }
+    devicePtr->tailPtr = requestPtr;
+    updateDepth(devicePtr, requestPtr->queuedTime, 1);
+    numAhead = devicePtr->queueDepth - 1
+                                     + (devicePtr->busy == True ? 1 : 0);
+
+    // wake device's service job
+    pthread_cond_signal(&devicePtr->requestQueued);
+    pthread_mutex_unlock(&devicePtr->deviceLock);
+
+    // return requests ahead
+    return numAhead;
+   }
+
+/*
+ * Function Name: updateDepth
+ * Algorithm: adds the waiting count held since the last change to the
+ *            depth area, then applies the change, tracking the maximum
+ * Precondition: given device, time of change in seconds, and change in
+ *               waiting count
+ * Postcondition: depth counters updated
+ * Exceptions: none
+ * Notes: a change stamped before the last one adds no area
+ */
+void updateDepth(IoDevice *devicePtr, double nowTime, int change)
+   {
+    // add area since last change
+    if (nowTime > devicePtr->depthTime)
+       {
+        devicePtr->depthArea += devicePtr->queueDepth
+                                         * (nowTime - devicePtr->depthTime);
+        devicePtr->depthTime = nowTime;
+       }
+
+    // apply change
+    devicePtr->queueDepth += change;
+    if (devicePtr->queueDepth > devicePtr->maxDepth)
+       {
+        devicePtr->maxDepth = devicePtr->queueDepth;
+       }
+   }
@@ -0,0 +1,88 @@
+// Preprocessor directive
+#ifndef DEVICE_SET_H
+#define DEVICE_SET_H
+
+// header files
+#include <stdlib.h>
+#include <limits.h>
+#include <pthread.h>
+#include "StringUtils.h"
+#include "Interrupts.h"
+#include "SimLog.h"
+#include "SimMetrics.h"
+
+// global constants
+#define DEVICE_TRACKS 1000
+#define DEVICE_TRACK_STRIDE 397
+
+// orders in which a device takes its waiting requests; none leaves
+// devices unmodeled, running every request at once with no contention
+typedef enum
+   {
+    IO_SCHED_NONE_CODE,
+    IO_SCHED_FIFO_CODE,
+    IO_SCHED_SSTF_CODE,
+    IO_SCHED_SCAN_CODE
+   } IoSchedCode;
+
+// one named device serving a single request at a time; waiting requests
+// are linked in arrival order, and the head track and sweep direction
+// pick the next one under SSTF and SCAN; depth area is the waiting count
+// integrated over time, for the average queue depth; in real time mode
+// the device lock guards everything here and the device's own service
+// job takes each request in turn
+typedef struct IoDevice
+   {
+    char *deviceName;
+    IoRequest *headPtr;
+    IoRequest *tailPtr;
+    Boolean busy;
+    Boolean stopFlag;
+    Boolean sweepUp;
+    int headTrack;
+    int queueDepth;
+    int maxDepth;
+    long numRequests;
+    long tracksMoved;
+    double freeTime;
+    double depthTime;
+    double depthArea;
+    double busyTime;
+    double queueWaitTime;
+    pthread_mutex_t deviceLock;
+    pthread_cond_t requestQueued;
+    WorkerJob serviceJob;
+    struct DeviceSet *setPtr;
+   } IoDevice;
+
+// every device of a program, indexed by the program's device number, with
+// the request order and full-stroke seek time in ms they share, and the
+// interrupt queue their completions are raised on
+typedef struct DeviceSet
+   {
+    IoDevice *devices;
+    int numDevices;
+    int schedCode;
+    int seekTime;
+    Boolean started;
+    InterruptQueue *queuePtr;
+   } DeviceSet;
+
+// function prototypes
+void clearDeviceSet(DeviceSet *setPtr);
+void completeDeviceIo(DeviceSet *setPtr, IoRequest *requestPtr);
+void *deviceService(void *devicePtr);
+void initDeviceSet(DeviceSet *setPtr, char (*deviceNames)[ STD_STR_LEN ],
+                      int numDevices, int schedCode, int seekTime,
+                                                   InterruptQueue *queuePtr);
+void logDeviceReport(SimLog *logPtr, DeviceSet *setPtr, double makespan);
+IoRequest *pickDeviceRequest(IoDevice *devicePtr, int schedCode);
+int requestTrack(int trackArg, int opIndex);
+int startDeviceIo(IoDevice *devicePtr, IoRequest *requestPtr,
+                                                         double startTime);
+void startDevices(DeviceSet *setPtr);
+void stopDevices(DeviceSet *setPtr);
+int submitDeviceIo(DeviceSet *setPtr, IoRequest *requestPtr);
+void updateDepth(IoDevice *devicePtr, double nowTime, int change);
+
+#endif // DEVICE_SET_H
@@ -0,0 +1,184 @@
+// header files
+#include "EventQueue.h"
+
+/*
+ * Function Name: clearEventQueue
+ * Algorithm: returns heap storage to OS and resets queue to empty
+ * Precondition: given initialized queue
+ * Postcondition: queue empty, storage released
+ * Exceptions: none
+ * Notes: event data pointers are not freed
+ */
+void clearEventQueue(EventQueue *queuePtr)
+   {
+    free(queuePtr->events);
+    queuePtr->events = NULL;
+    queuePtr->count = 0;
+    queuePtr->capacity = 0;
+   }
+
+/*
+ * Function Name: eventBefore
+ * Algorithm: orders two events by time, then by push sequence
+ * Precondition: given two events
+ * Postcondition: True returned if first event must pop before second
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean eventBefore(SimEvent *firstPtr, SimEvent *secondPtr)
+   {
+    // check for earlier time
+    if (firstPtr->eventTime != secondPtr->eventTime)
+       {
+        return firstPtr->eventTime < secondPtr->eventTime;
+       }
+
+    // otherwise, earlier push wins
+    return firstPtr->sequence < secondPtr->sequence;
+   }
+
+/*
+ * Function Name: initEventQueue
+ * Algorithm: sets queue to empty with no storage allocated
+ * Precondition: given queue storage
+ * Postcondition: queue ready for use
+ * Exceptions: none
+ * Notes: storage is allocated on first push
+ */
+void initEventQueue(EventQueue *queuePtr)
+   {
+    queuePtr->events = NULL;
+    queuePtr->count = 0;
+    queuePtr->capacity = 0;
+    queuePtr->nextSequence = 0;
+   }
+
+/*
+ * Function Name: peekEvent
+ * Algorithm: copies earliest event without removing it
+ * Precondition: given queue and event storage
+ * Postcondition: earliest event copied, True returned; False if empty
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean peekEvent(EventQueue *queuePtr, SimEvent *eventPtr)
+   {
+    // check for empty queue
+    if (queuePtr->count == 0)
+       {
+        return False;
+       }
+
+    // copy heap root
+    *eventPtr = queuePtr->events[0];
+    return True;
+   }
+
+/*
+ * Function Name: popEvent
+ * Algorithm: removes heap root, moves last event to root and sifts it down
+ * Precondition: given queue and event storage
+ * Postcondition: earliest event removed and copied, True returned;
+ *                False if empty
+ * Exceptions: none
+ * Notes: O(log n)
+ */
+Boolean popEvent(EventQueue *queuePtr, SimEvent *eventPtr)
+   {
+    // initialize function/variables
+    SimEvent *heap = queuePtr->events;
+    SimEvent temp;
+    int index = 0, child;
+
+    // check for empty queue
+    if (queuePtr->count == 0)
+       {
+        return False;
+       }
+
+    // take root and move last event into its place
+    *eventPtr = heap[0];
+    queuePtr->count--;
+    heap[0] = heap[queuePtr->count];
+
+    // sift down until heap order restored
+    child = 1;
+    while (child < queuePtr->count)
+       {
+        // pick earlier of the two children
+        if (child + 1 < queuePtr->count
+                            && eventBefore(&heap[child + 1], &heap[child]))
+           {
+            child++;
+           }
+
+        // stop once parent is in order
+        if (eventBefore(&heap[child], &heap[index]) == False)
+           {
+            break;
+           }
+
+        // swap parent with child and continue down
+        temp = heap[index];
+        heap[index] = heap[child];
+        heap[child] = temp;
+        index = child;
+        child = 2 * index + 1;
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: pushEvent
+ * Algorithm: appends event at heap end, growing storage as needed, and
+ *            sifts it up
+ * Precondition: given queue, event time, and event data
+ * Postcondition: event queued
+ * Exceptions: none
+ * Notes: O(log n) amortized
+ */
+void pushEvent(EventQueue *queuePtr, double eventTime, void *dataPtr)
+   {
+    // initialize function/variables
+    SimEvent *heap;
+    SimEvent temp;
+    int index, parent;
+
+    // grow storage, if full
+    if (queuePtr->count == queuePtr->capacity)
+       {
+        queuePtr->capacity = queuePtr->capacity == 0 ?
+                              INIT_EVENT_CAPACITY : queuePtr->capacity * 2;
+        queuePtr->events = (SimEvent*)realloc(queuePtr->events,
+                                    sizeof(SimEvent) * queuePtr->capacity);
+       }
+
+    // place new event at end
+    heap = queuePtr->events;
+    index = queuePtr->count;
+    heap[index].eventTime = eventTime;
+    heap[index].sequence = queuePtr->nextSequence;
+    heap[index].dataPtr = dataPtr;
+    queuePtr->nextSequence++;
+    queuePtr->count++;
+
+    // sift up until heap order restored
+    while (index > 0)
+       {
+        parent = (index - 1) / 2;
+
+        // stop once parent is in order
+        if (eventBefore(&heap[index], &heap[parent]) == False)
+           {
+            break;
+           }
+
+        // swap with parent and continue up
+        temp = heap[index];
+        heap[index] = heap[parent];
+        heap[parent] = temp;
+        index = parent;
+       }
+   }
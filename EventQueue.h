@@ -0,0 +1,38 @@
+// Preprocessor directive
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+// header files
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// global constants
+#define INIT_EVENT_CAPACITY 64
+
+// timestamped entry; sequence breaks ties so equal times pop in the order
+// they were pushed
+typedef struct SimEvent
+   {
+    double eventTime;
+    long sequence;
+    void *dataPtr;
+   } SimEvent;
+
+// binary min-heap of events ordered by time
+typedef struct EventQueue
+   {
+    SimEvent *events;
+    int count;
+    int capacity;
+    long nextSequence;
+   } EventQueue;
+
+// function prototypes
+void clearEventQueue(EventQueue *queuePtr);
+Boolean eventBefore(SimEvent *firstPtr, SimEvent *secondPtr);
+void initEventQueue(EventQueue *queuePtr);
+Boolean peekEvent(EventQueue *queuePtr, SimEvent *eventPtr);
+Boolean popEvent(EventQueue *queuePtr, SimEvent *eventPtr);
+void pushEvent(EventQueue *queuePtr, double eventTime, void *dataPtr);
+
+#endif // EVENT_QUEUE_H
@@ -0,0 +1,410 @@
+// header files
+#include "Interrupts.h"
+
+/*
+ * Function Name: arrivalFeeder
+ * Algorithm: worker pool job for real time arrivals; takes each pending
+ *            arrival in time order, sleeps until it is due, then raises
+ *            its interrupt
+ * Precondition: given interrupt queue with every arrival scheduled
+ * Postcondition: every arrival raised
+ * Exceptions: none
+ * Notes: only this job touches the arrival heap once started
+ */
+void *arrivalFeeder(void *queuePtr)
+   {
+    // initialize function/variables
+    InterruptQueue *queue = queuePtr;
+    SimEvent event;
+    int delay;
+
+    // raise arrivals in time order, each once due
+    while (popEvent(&queue->pendingArrivals, &event) == True)
+       {
+        delay = (int)(event.eventTime * MS_PER_SEC
+                                - readRealClock(queue->clockPtr) * MS_PER_SEC);
+        if (delay > 0)
+           {
+            runTimer(delay);
+           }
+        raiseInterrupt(queue, event.dataPtr);
+       }
+
+    return NULL;
+   }
+
+/*
+ * Function Name: createArrival
+ * Algorithm: allocates and fills in a request that stands for a process
+ *            arriving
+ * Precondition: given arriving pid, arrival time in ms from simulation
+ *               start, owner pointer, and the interrupt queue to report to
+ * Postcondition: new arrival request returned, not yet scheduled
+ * Exceptions: none
+ * Notes: the request never runs as a job, so it is marked done for
+ *        takeInterrupt
+ */
+IoRequest *createArrival(int pid, int arrivalTime, void *ownerPtr,
+                                                 InterruptQueue *queuePtr)
+   {
+    // initialize function/variables
+    IoRequest *requestPtr = createIoRequest(pid, arrivalTime, False, "",
+                                                         ownerPtr, queuePtr);
+
+    // mark as arrival with no job to wait for
+    requestPtr->isArrival = True;
+    requestPtr->job.jobDone = True;
+
+    // return new request
+    return requestPtr;
+   }
+
+/*
+ * Function Name: createIoRequest
+ * Algorithm: allocates and fills in a new I/O request
+ * Precondition: given owning pid, op time in ms, direction, device name,
+ *               owner pointer, and the interrupt queue to report back to
+ * Postcondition: new request returned, not yet linked into any queue
+ * Exceptions: none
+ * Notes: the dispatcher frees the request after taking its interrupt
+ */
+IoRequest *createIoRequest(int pid, int ioTime, Boolean isInput,
+                              char *deviceName, void *ownerPtr,
+                                                InterruptQueue *queuePtr)
+   {
+    // initialize function/variables
+    IoRequest *requestPtr = (IoRequest*)malloc(sizeof(IoRequest));
+
+    // set request data
+    requestPtr->pid = pid;
+    requestPtr->ioTime = ioTime;
+    requestPtr->isInput = isInput;
+    requestPtr->isArrival = False;
+    copyString(requestPtr->deviceName, deviceName);
+    requestPtr->deviceId = 0;
+    requestPtr->trackNum = 0;
+    requestPtr->queuedTime = 0.0;
+    requestPtr->ownerPtr = ownerPtr;
+    requestPtr->queuePtr = queuePtr;
+    requestPtr->nextNode = NULL;
+
+    // return new request
+    return requestPtr;
+   }
+
+/*
+ * Function Name: destroyInterruptQueue
+ * Algorithm: releases any interrupts never taken, then the queue's
+ *            pending heap and synchronization objects
+ * Precondition: given initialized queue with no I/O still in flight
+ * Postcondition: queue emptied and released
+ * Exceptions: none
+ * Notes: none
+ */
+void destroyInterruptQueue(InterruptQueue *queuePtr)
+   {
+    // initialize function/variables
+    IoRequest *requestPtr;
+    SimEvent event;
+
+    // release remaining requests
+    while (queuePtr->headPtr != NULL)
+       {
+        requestPtr = queuePtr->headPtr;
+        queuePtr->headPtr = requestPtr->nextNode;
+        free(requestPtr);
+       }
+    queuePtr->tailPtr = NULL;
+
+    // release requests still pending on virtual clock, and arrivals never
+    // raised
+    while (popEvent(&queuePtr->pendingIo, &event) == True)
+       {
+        free(event.dataPtr);
+       }
+    clearEventQueue(&queuePtr->pendingIo);
+    while (popEvent(&queuePtr->pendingArrivals, &event) == True)
+       {
+        free(event.dataPtr);
+       }
+    clearEventQueue(&queuePtr->pendingArrivals);
+
+    // release synchronization objects
+    pthread_cond_destroy(&queuePtr->interruptRaised);
+    pthread_mutex_destroy(&queuePtr->queueLock);
+   }
+
+/*
+ * Function Name: initInterruptQueue
+ * Algorithm: sets queue to empty and initializes its lock and condition
+ * Precondition: given queue storage, simulator clock, and the pool that
+ *               runs device ops in real time mode
+ * Postcondition: queue ready for use
+ * Exceptions: none
+ * Notes: none
+ */
+void initInterruptQueue(InterruptQueue *queuePtr, SimClock *clockPtr,
+                                                        WorkerPool *poolPtr)
+   {
+    queuePtr->headPtr = NULL;
+    queuePtr->tailPtr = NULL;
+    pthread_mutex_init(&queuePtr->queueLock, NULL);
+    pthread_cond_init(&queuePtr->interruptRaised, NULL);
+    queuePtr->clockPtr = clockPtr;
+    queuePtr->poolPtr = poolPtr;
+    initEventQueue(&queuePtr->pendingIo);
+    initEventQueue(&queuePtr->pendingArrivals);
+    queuePtr->wakeFunc = NULL;
+    queuePtr->wakeArg = NULL;
+   }
+
+/*
+ * Function Name: interruptPending
+ * Algorithm: checks for a completed I/O request without removing it; in
+ *            virtual clock mode only completions due by now count
+ * Precondition: given initialized queue
+ * Postcondition: True returned if takeInterrupt would return a request
+ *                without waiting
+ * Exceptions: none
+ * Notes: used by preemptive schedulers to cut a running cpu op short
+ */
+Boolean interruptPending(InterruptQueue *queuePtr)
+   {
+    // initialize function/variables
+    Boolean pending;
+    SimEvent event;
+
+    // check for virtual clock mode
+    if (queuePtr->clockPtr->virtualMode == True)
+       {
+        return peekEvent(&queuePtr->pendingIo, &event) == True
+               && event.eventTime <= queuePtr->clockPtr->currentTime;
+       }
+
+    // check queue head under lock
+    pthread_mutex_lock(&queuePtr->queueLock);
+    pending = queuePtr->headPtr != NULL;
+    pthread_mutex_unlock(&queuePtr->queueLock);
+
+    // return result
+    return pending;
+   }
+
+/*
+ * Function Name: ioDeviceOp
+ * Algorithm: worker pool job for a device; runs the op timer, then raises
+ *            an interrupt for the owning process
+ * Precondition: given I/O request
+ * Postcondition: request placed on its interrupt queue
+ * Exceptions: none
+ * Notes: none
+ */
+void *ioDeviceOp(void *requestPtr)
+   {
+    // initialize function/variables
+    IoRequest *request = requestPtr;
+
+    // run device time, then report completion
+    runTimer(request->ioTime);
+    raiseInterrupt(request->queuePtr, request);
+    return NULL;
+   }
+
+/*
+ * Function Name: raiseInterrupt
+ * Algorithm: appends a completed request to the queue tail, wakes the
+ *            dispatcher if it is idle, and calls the wake function, if set
+ * Precondition: given queue and completed request
+ * Postcondition: request queued
+ * Exceptions: none
+ * Notes: safe to call from any thread
+ */
+void raiseInterrupt(InterruptQueue *queuePtr, IoRequest *requestPtr)
+   {
+    // append to tail
+    pthread_mutex_lock(&queuePtr->queueLock);
+    requestPtr->nextNode = NULL;
+    if (queuePtr->tailPtr == NULL)
+       {
+        queuePtr->headPtr = requestPtr;
+       }
+    else
+       {
+        queuePtr->tailPtr->nextNode = requestPtr;
+       }
+    queuePtr->tailPtr = requestPtr;
+
+    // wake waiting dispatcher
+    pthread_cond_signal(&queuePtr->interruptRaised);
+    pthread_mutex_unlock(&queuePtr->queueLock);
+
+    // notify any other waiters outside of lock
+    if (queuePtr->wakeFunc != NULL)
+       {
+        queuePtr->wakeFunc(queuePtr->wakeArg);
+       }
+   }
+
+/*
+ * Function Name: scheduleArrival
+ * Algorithm: records an arrival at its time; virtual mode adds it to the
+ *            pending completions, real time mode to the pending arrivals
+ *            raised once startArrivals runs
+ * Precondition: given queue and new arrival request, before arrivals are
+ *               started
+ * Postcondition: request will surface from takeInterrupt once due
+ * Exceptions: none
+ * Notes: none
+ */
+void scheduleArrival(InterruptQueue *queuePtr, IoRequest *requestPtr)
+   {
+    // initialize function/variables
+    double arrivalTime = (double)requestPtr->ioTime / MS_PER_SEC;
+
+    // check for virtual clock mode
+    if (queuePtr->clockPtr->virtualMode == True)
+       {
+        pushEvent(&queuePtr->pendingIo, arrivalTime, requestPtr);
+       }
+
+    // otherwise, hold for arrival feeder
+    else
+       {
+        pushEvent(&queuePtr->pendingArrivals, arrivalTime, requestPtr);
+       }
+   }
+
+/*
+ * Function Name: scheduleIo
+ * Algorithm: starts an I/O request; real time mode hands it to a pool
+ *            worker, virtual mode records its completion time
+ * Precondition: given queue and new request
+ * Postcondition: request will surface from takeInterrupt once complete
+ * Exceptions: none
+ * Notes: none
+ */
+void scheduleIo(InterruptQueue *queuePtr, IoRequest *requestPtr)
+   {
+    // initialize function/variables
+    SimClock *clockPtr = queuePtr->clockPtr;
+
+    // check for virtual clock mode
+    if (clockPtr->virtualMode == True)
+       {
+        pushEvent(&queuePtr->pendingIo, timeAfter(clockPtr->currentTime,
+                                        requestPtr->ioTime), requestPtr);
+       }
+
+    // otherwise, run device time on a worker
+    else
+       {
+        submitJob(queuePtr->poolPtr, &requestPtr->job,
+                                                   &ioDeviceOp, requestPtr);
+       }
+   }
+
+/*
+ * Function Name: setInterruptWake
+ * Algorithm: records a function to call after each interrupt is raised
+ * Precondition: given initialized queue, wake function, and its argument
+ * Postcondition: wake function installed
+ * Exceptions: none
+ * Notes: wake function runs on the raising device thread, so it must not
+ *        take any lock held by a dispatcher waiting in takeInterrupt
+ */
+void setInterruptWake(InterruptQueue *queuePtr, JobFunction wakeFunc,
+                                                              void *wakeArg)
+   {
+    queuePtr->wakeFunc = wakeFunc;
+    queuePtr->wakeArg = wakeArg;
+   }
+
+/*
+ * Function Name: startArrivals
+ * Algorithm: hands pending real time arrivals to one pool worker that
+ *            raises each when due
+ * Precondition: given queue with every arrival scheduled
+ * Postcondition: arrival feeder running and True returned, or False
+ *                returned if no arrivals pending
+ * Exceptions: none
+ * Notes: pool needs one worker for the feeder beyond those for I/O; the
+ *        feeder ends once the last arrival is raised, before the
+ *        simulation can complete
+ */
+Boolean startArrivals(InterruptQueue *queuePtr)
+   {
+    // check for nothing to feed
+    if (queuePtr->pendingArrivals.count == 0)
+       {
+        return False;
+       }
+
+    // start feeder
+    submitJob(queuePtr->poolPtr, &queuePtr->arrivalJob, &arrivalFeeder,
+                                                                   queuePtr);
+    return True;
+   }
+
+/*
+ * Function Name: takeInterrupt
+ * Algorithm: removes and returns the oldest pending interrupt, optionally
+ *            blocking until one is raised; in virtual clock mode waiting
+ *            advances the clock to the next completion instead of blocking
+ * Precondition: given queue and flag to wait when empty
+ * Postcondition: oldest request returned, or NULL if empty and not waiting
+ * Exceptions: none
+ * Notes: real time requests are only returned once their worker has
+ *        released them, so the caller may free them
+ */
+IoRequest *takeInterrupt(InterruptQueue *queuePtr, Boolean waitFlag)
+   {
+    // initialize function/variables
+    IoRequest *requestPtr;
+    SimEvent event;
+
+    // check for virtual clock mode
+    if (queuePtr->clockPtr->virtualMode == True)
+       {
+        // check for completion due now, or next completion when waiting
+        if (peekEvent(&queuePtr->pendingIo, &event) == True
+            && (waitFlag == True
+                || event.eventTime <= queuePtr->clockPtr->currentTime))
+           {
+            popEvent(&queuePtr->pendingIo, &event);
+            advanceClockTo(queuePtr->clockPtr, event.eventTime);
+            return event.dataPtr;
+           }
+
+        // nothing has completed yet
+        return NULL;
+       }
+
+    // wait for interrupt, if requested
+    pthread_mutex_lock(&queuePtr->queueLock);
+    while (waitFlag == True && queuePtr->headPtr == NULL)
+       {
+        pthread_cond_wait(&queuePtr->interruptRaised, &queuePtr->queueLock);
+       }
+
+    // pop head, if any
+    requestPtr = queuePtr->headPtr;
+    if (requestPtr != NULL)
+       {
+        queuePtr->headPtr = requestPtr->nextNode;
+        if (queuePtr->headPtr == NULL)
+           {
+            queuePtr->tailPtr = NULL;
+           }
+        requestPtr->nextNode = NULL;
+       }
+    pthread_mutex_unlock(&queuePtr->queueLock);
+
+    // ensure worker is done with the request
+    if (requestPtr != NULL)
+       {
+        waitForJob(queuePtr->poolPtr, &requestPtr->job);
+       }
+
+    // return request or null
+    return requestPtr;
+   }
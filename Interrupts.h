@@ -0,0 +1,80 @@
+// Preprocessor directive
+#ifndef INTERRUPTS_H
+#define INTERRUPTS_H
+
+// header files
+#include <stdlib.h>
+#include <pthread.h>
+#include "StringUtils.h"
+#include "simtimer.h"
+#include "WorkerPool.h"
+#include "EventQueue.h"
+#include "SimClock.h"
+
+// global constants; without per-device queues each process blocked on
+// I/O holds a pool worker, up to this many, beyond which I/O waits for a
+// worker to free up and so finishes later than its own time
+#define MAX_IO_THREADS 64
+
+// outstanding I/O request; run on a pool worker, then handed back to the
+// dispatcher through the interrupt queue; an arrival request instead
+// raises its interrupt when its process arrives, ioTime ms after the
+// simulation starts; device number, track, and queued time are used only
+// when requests wait in per-device queues
+typedef struct IoRequest
+   {
+    WorkerJob job;
+    int pid;
+    int ioTime;
+    Boolean isInput;
+    Boolean isArrival;
+    char deviceName[ STD_STR_LEN ];
+    int deviceId;
+    int trackNum;
+    double queuedTime;
+    void *ownerPtr;
+    struct InterruptQueue *queuePtr;
+    struct IoRequest *nextNode;
+   } IoRequest;
+
+// FIFO of completed I/O requests waiting for the dispatcher; in virtual
+// clock mode requests instead wait in a heap keyed by completion time;
+// in real time mode arrivals wait in their own heap for one pool worker
+// to raise each in turn; an optional wake function is called after each
+// interrupt is raised
+typedef struct InterruptQueue
+   {
+    IoRequest *headPtr;
+    IoRequest *tailPtr;
+    pthread_mutex_t queueLock;
+    pthread_cond_t interruptRaised;
+    SimClock *clockPtr;
+    WorkerPool *poolPtr;
+    EventQueue pendingIo;
+    EventQueue pendingArrivals;
+    WorkerJob arrivalJob;
+    JobFunction wakeFunc;
+    void *wakeArg;
+   } InterruptQueue;
+
+// function prototypes
+void *arrivalFeeder(void *queuePtr);
+IoRequest *createArrival(int pid, int arrivalTime, void *ownerPtr,
+                                                InterruptQueue *queuePtr);
+IoRequest *createIoRequest(int pid, int ioTime, Boolean isInput,
+                              char *deviceName, void *ownerPtr,
+                                               InterruptQueue *queuePtr);
+void destroyInterruptQueue(InterruptQueue *queuePtr);
+void initInterruptQueue(InterruptQueue *queuePtr, SimClock *clockPtr,
+                                                      WorkerPool *poolPtr);
+Boolean interruptPending(InterruptQueue *queuePtr);
+void *ioDeviceOp(void *requestPtr);
+void raiseInterrupt(InterruptQueue *queuePtr, IoRequest *requestPtr);
+void scheduleArrival(InterruptQueue *queuePtr, IoRequest *requestPtr);
+void scheduleIo(InterruptQueue *queuePtr, IoRequest *requestPtr);
+void setInterruptWake(InterruptQueue *queuePtr, JobFunction wakeFunc,
+                                                             void *wakeArg);
+Boolean startArrivals(InterruptQueue *queuePtr);
+IoRequest *takeInterrupt(InterruptQueue *queuePtr, Boolean waitFlag);
+
+#endif // INTERRUPTS_H
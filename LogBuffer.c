@@ -0,0 +1,257 @@
+// header files
+#include "LogBuffer.h"
+
+/*
+ * Function Name: appendLog
+ * Algorithm: queues a c-style string, without its terminator
+ * Precondition: given opened buffer and c-style string
+ * Postcondition: string queued for the writer thread
+ * Exceptions: none
+ * Notes: none
+ */
+void appendLog(LogBuffer *logPtr, char *outputStr)
+   {
+    appendLogBytes(logPtr, outputStr, (size_t)getStringLength(outputStr));
+   }
+
+/*
+ * Function Name: appendLogBytes
+ * Algorithm: copies bytes into the ring at the producer position,
+ *            wrapping at the ring end and yielding while the writer makes
+ *            room, then publishes the new position
+ * Precondition: given opened buffer, data, and its size in bytes
+ * Postcondition: data queued for the writer thread
+ * Exceptions: none
+ * Notes: single producer only; never allocates, so memory use is fixed
+ *        by the ring size however long the simulation runs
+ */
+void appendLogBytes(LogBuffer *logPtr, void *dataPtr, size_t dataSize)
+   {
+    // initialize function/variables
+    char *bytePtr = dataPtr;
+    size_t remaining = dataSize;
+    size_t head, tail, freeBytes, offset, chunk;
+
+    // check for buffer not opened
+    if (logPtr->writerRunning == False)
+       {
+        return;
+       }
+
+    // loop until all data is queued
+    head = atomic_load_explicit(&logPtr->headPos, memory_order_relaxed);
+    while (remaining > 0)
+       {
+        // find free space, yielding to writer while ring is full
+        tail = atomic_load_explicit(&logPtr->tailPos, memory_order_acquire);
+        freeBytes = logPtr->ringSize - (head - tail);
+        if (freeBytes == 0)
+           {
+            sched_yield();
+            continue;
+           }
+
+        // copy as much as fits before the ring end
+        offset = head & (logPtr->ringSize - 1);
+        chunk = logPtr->ringSize - offset;
+        if (chunk > freeBytes)
+           {
+            chunk = freeBytes;
+           }
+        if (chunk > remaining)
+           {
+            chunk = remaining;
+           }
+        memcpy(logPtr->ring + offset, bytePtr, chunk);
+
+        // publish copied bytes to writer
+        head += chunk;
+        bytePtr += chunk;
+        remaining -= chunk;
+        atomic_store_explicit(&logPtr->headPos, head, memory_order_release);
+       }
+   }
+
+/*
+ * Function Name: closeLogBuffer
+ * Algorithm: signals the writer to drain everything left and exit, joins
+ *            it, then closes the file and releases the ring
+ * Precondition: given initialized buffer, opened or not
+ * Postcondition: all queued output written, resources released,
+ *                True returned if every write succeeded
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean closeLogBuffer(LogBuffer *logPtr)
+   {
+    // initialize function/variables
+    Boolean success = True;
+
+    // check for buffer opened
+    if (logPtr->writerRunning == True)
+       {
+        // stop and join writer
+        atomic_store_explicit(&logPtr->stopFlag, 1, memory_order_release);
+        pthread_join(logPtr->writerThread, NULL);
+
+        // close file and check for any failed write
+        success = fclose(logPtr->filePtr) == 0
+                                      && logPtr->writeFailed == False;
+       }
+
+    // release ring and reset
+    free(logPtr->ring);
+    initLogBuffer(logPtr);
+    return success;
+   }
+
+/*
+ * Function Name: drainLogRing
+ * Algorithm: writes every published byte to the file once at least the
+ *            given number are waiting, in up to two fwrite calls around
+ *            the ring end, then releases the space to the producer
+ * Precondition: given opened buffer and minimum byte count to write
+ * Postcondition: waiting bytes written and flushed, count returned
+ * Exceptions: none
+ * Notes: called only from the writer thread
+ */
+size_t drainLogRing(LogBuffer *logPtr, size_t minBytes)
+   {
+    // initialize function/variables
+    size_t tail = atomic_load_explicit(&logPtr->tailPos, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&logPtr->headPos, memory_order_acquire);
+    size_t waiting = head - tail;
+    size_t offset, chunk;
+
+    // check for too little to write
+    if (waiting == 0 || waiting < minBytes)
+       {
+        return 0;
+       }
+
+    // write from tail to ring end, if wrapped
+    offset = tail & (logPtr->ringSize - 1);
+    chunk = logPtr->ringSize - offset;
+    if (chunk > waiting)
+       {
+        chunk = waiting;
+       }
+    if (fwrite(logPtr->ring + offset, 1, chunk, logPtr->filePtr) != chunk)
+       {
+        logPtr->writeFailed = True;
+       }
+
+    // write any remainder from ring start
+    if (waiting > chunk && fwrite(logPtr->ring, 1, waiting - chunk,
+                                       logPtr->filePtr) != waiting - chunk)
+       {
+        logPtr->writeFailed = True;
+       }
+
+    // push to OS so output survives a crash, then free ring space
+    fflush(logPtr->filePtr);
+    atomic_store_explicit(&logPtr->tailPos, head, memory_order_release);
+    return waiting;
+   }
+
+/*
+ * Function Name: initLogBuffer
+ * Algorithm: sets buffer to closed and empty
+ * Precondition: given buffer storage
+ * Postcondition: buffer safe to append to (ignored) or close
+ * Exceptions: none
+ * Notes: none
+ */
+void initLogBuffer(LogBuffer *logPtr)
+   {
+    logPtr->ring = NULL;
+    logPtr->ringSize = 0;
+    logPtr->flushSize = 0;
+    atomic_init(&logPtr->headPos, 0);
+    atomic_init(&logPtr->tailPos, 0);
+    atomic_init(&logPtr->stopFlag, 0);
+    logPtr->filePtr = NULL;
+    logPtr->writerRunning = False;
+    logPtr->writeFailed = False;
+   }
+
+/*
+ * Function Name: logWriterLoop
+ * Algorithm: writer thread body; writes the ring out each time a flush
+ *            size of bytes is waiting, sleeping briefly otherwise, and
+ *            drains whatever remains on stop
+ * Precondition: given opened buffer
+ * Postcondition: thread exits with ring empty
+ * Exceptions: none
+ * Notes: none
+ */
+void *logWriterLoop(void *logBufferPtr)
+   {
+    // initialize function/variables
+    LogBuffer *logPtr = logBufferPtr;
+    struct timespec pollTime = { 0, LOG_POLL_NSEC };
+
+    // loop until stop requested
+    while (atomic_load_explicit(&logPtr->stopFlag,
+                                             memory_order_acquire) == 0)
+       {
+        // write a full flush, or wait for more output
+        if (drainLogRing(logPtr, logPtr->flushSize) == 0)
+           {
+            nanosleep(&pollTime, NULL);
+           }
+       }
+
+    // write everything left
+    drainLogRing(logPtr, 0);
+    return NULL;
+   }
+
+/*
+ * Function Name: openLogBuffer
+ * Algorithm: opens the log file, sizes the ring to a power of two holding
+ *            several flushes, and starts the writer thread
+ * Precondition: given initialized buffer, file name, and flush size in
+ *               bytes (zero or less selects the default)
+ * Postcondition: buffer streaming to file, True returned on success
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean openLogBuffer(LogBuffer *logPtr, char *fileName, int flushSize)
+   {
+    // set flush size
+    if (flushSize <= 0)
+       {
+        flushSize = DEFAULT_LOG_FLUSH_SIZE;
+       }
+    logPtr->flushSize = (size_t)flushSize;
+
+    // open file for writing
+    logPtr->filePtr = fopen(fileName, "w");
+    if (logPtr->filePtr == NULL)
+       {
+        return False;
+       }
+
+    // size ring to next power of two above several flushes
+    logPtr->ringSize = 1;
+    while (logPtr->ringSize < logPtr->flushSize * LOG_RING_FLUSH_MULTIPLE)
+       {
+        logPtr->ringSize *= 2;
+       }
+    logPtr->ring = (char*)malloc(logPtr->ringSize);
+
+    // start writer thread
+    if (pthread_create(&logPtr->writerThread, NULL,
+                                           &logWriterLoop, logPtr) != 0)
+       {
+        fclose(logPtr->filePtr);
+        free(logPtr->ring);
+        initLogBuffer(logPtr);
+        return False;
+       }
+    logPtr->writerRunning = True;
+
+    // return success
+    return True;
+   }
@@ -0,0 +1,46 @@
+// Preprocessor directive
+#ifndef LOG_BUFFER_H
+#define LOG_BUFFER_H
+
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include "StringUtils.h"
+
+// global constants
+#define DEFAULT_LOG_FLUSH_SIZE 4096
+#define LOG_RING_FLUSH_MULTIPLE 4
+#define LOG_POLL_NSEC 1000000L
+
+// fixed-size single producer/single consumer byte ring; the simulator
+// appends text or binary records, a background writer thread drains it to
+// the log file whenever a flush size of bytes is waiting
+typedef struct LogBuffer
+   {
+    char *ring;
+    size_t ringSize;
+    size_t flushSize;
+    atomic_size_t headPos;
+    atomic_size_t tailPos;
+    atomic_int stopFlag;
+    FILE *filePtr;
+    pthread_t writerThread;
+    Boolean writerRunning;
+    Boolean writeFailed;
+   } LogBuffer;
+
+// function prototypes
+void appendLog(LogBuffer *logPtr, char *outputStr);
+void appendLogBytes(LogBuffer *logPtr, void *dataPtr, size_t dataSize);
+Boolean closeLogBuffer(LogBuffer *logPtr);
+size_t drainLogRing(LogBuffer *logPtr, size_t minBytes);
+void initLogBuffer(LogBuffer *logPtr);
+void *logWriterLoop(void *logBufferPtr);
+Boolean openLogBuffer(LogBuffer *logPtr, char *fileName, int flushSize);
+
+#endif // LOG_BUFFER_H
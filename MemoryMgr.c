@@ -0,0 +1,537 @@
+// header files
+#include "MemoryMgr.h"
+
+/*
+ * Function Name: accessSegment
+ * Algorithm: finds the process segment starting at or before the access
+ *            start and checks that the whole access range lies inside it
+ * Precondition: given memory manager, owning pid, access start, and size
+ * Postcondition: True returned if range is within one segment allocated
+ *                to that process
+ * Exceptions: none
+ * Notes: O(log n) in number of process segments
+ */
+Boolean accessSegment(MemoryMgr *mgrPtr, int pid, int start, int size)
+   {
+    // initialize function/variables
+    SegmentTable *tablePtr = &mgrPtr->tables[ pid ];
+    int index = findSegment(tablePtr, start);
+
+    // check for containing segment
+    return index != NO_SEGMENT && size >= 0
+                         && start + size <= tablePtr->segments[ index ].end;
+   }
+
+/*
+ * Function Name: allocateSegment
+ * Algorithm: rejects ranges outside the address space, then checks the
+ *            neighbours on either side of the insertion point in the
+ *            process table for overlap, rejects segments larger than the
+ *            memory still free, places the segment in physical memory when
+ *            a placement policy is set, and inserts it in sorted position
+ * Precondition: given memory manager, owning pid, segment start, and size
+ * Postcondition: segment recorded and True returned, or False returned
+ *                with no change if it does not fit
+ * Exceptions: none
+ * Notes: search is O(log n); insertion shifts the table tail in one move;
+ *        failures for lack of memory and for lack of a large enough hole
+ *        are counted apart
+ */
+Boolean allocateSegment(MemoryMgr *mgrPtr, int pid, int start, int size)
+   {
+    // initialize function/variables
+    SegmentTable *tablePtr = &mgrPtr->tables[ pid ];
+    int end = start + size;
+    int index, physBase = 0;
+
+    // check for range outside address space
+    if (start < 0 || size <= 0 || end > mgrPtr->memAvailable)
+       {
+        return False;
+       }
+
+    // check for overlap with segment starting at or before new start
+    index = findSegment(tablePtr, start);
+    if (index != NO_SEGMENT && tablePtr->segments[ index ].end > start)
+       {
+        return False;
+       }
+
+    // check for overlap with next segment
+    index++;
+    if (index < tablePtr->count && tablePtr->segments[ index ].start < end)
+       {
+        return False;
+       }
+
+    // check for segment larger than free memory
+    if (mgrPtr->memUsed + size > mgrPtr->memAvailable)
+       {
+        mgrPtr->sizeFailures++;
+        return False;
+       }
+
+    // place segment in physical memory, if placing
+    if (mgrPtr->fitCode != MEM_FIT_NONE_CODE)
+       {
+        physBase = placeSegment(mgrPtr, size);
+        if (physBase == NO_SEGMENT)
+           {
+            return False;
+           }
+       }
+
+    // grow segment storage when full
+    if (tablePtr->count == tablePtr->capacity)
+       {
+        tablePtr->capacity = tablePtr->capacity == 0
+                             ? INIT_SEGMENT_CAPACITY : tablePtr->capacity * 2;
+        tablePtr->segments = (MemSegment*)realloc(tablePtr->segments,
+                                     sizeof(MemSegment) * tablePtr->capacity);
+       }
+
+    // shift tail up and insert in sorted position
+    memmove(&tablePtr->segments[ index + 1 ], &tablePtr->segments[ index ],
+                           sizeof(MemSegment) * (tablePtr->count - index));
+    tablePtr->segments[ index ].start = start;
+    tablePtr->segments[ index ].end = end;
+    tablePtr->segments[ index ].physBase = physBase;
+    tablePtr->count++;
+    mgrPtr->memUsed += size;
+    if (mgrPtr->memUsed > mgrPtr->peakUsed)
+       {
+        mgrPtr->peakUsed = mgrPtr->memUsed;
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: clearMemoryMgr
+ * Algorithm: releases every process table, then the table and hole arrays
+ * Precondition: given initialized memory manager
+ * Postcondition: no segments allocated, storage returned to OS
+ * Exceptions: none
+ * Notes: none
+ */
+void clearMemoryMgr(MemoryMgr *mgrPtr)
+   {
+    // initialize function/variables
+    int pid;
+
+    // release each process table
+    for (pid = 0; pid < mgrPtr->numTables; pid++)
+       {
+        releaseProcessMemory(mgrPtr, pid);
+       }
+
+    // release table and hole arrays
+    free(mgrPtr->tables);
+    mgrPtr->tables = NULL;
+    mgrPtr->numTables = 0;
+    free(mgrPtr->holes);
+    mgrPtr->holes = NULL;
+    mgrPtr->numHoles = 0;
+    mgrPtr->holeCapacity = 0;
+   }
+
+/*
+ * Function Name: compactMemory
+ * Algorithm: gathers every placed segment, sorts them by physical base,
+ *            and slides each down against the one below it, leaving all
+ *            free memory in one hole at the top
+ * Precondition: given memory manager with a placement policy
+ * Postcondition: segments packed from address 0, compaction counted;
+ *                bytes moved returned
+ * Exceptions: none
+ * Notes: logical addresses are unchanged, so processes see no difference
+ */
+int compactMemory(MemoryMgr *mgrPtr)
+   {
+    // initialize function/variables
+    MemSegment **segmentPtrs;
+    SegmentTable *tablePtr;
+    int pid, index, numSegments = 0, nextBase = 0, moved = 0;
+
+    // gather every segment
+    for (pid = 0; pid < mgrPtr->numTables; pid++)
+       {
+        numSegments += mgrPtr->tables[ pid ].count;
+       }
+    segmentPtrs = (MemSegment**)malloc(sizeof(MemSegment*)
+                                     * (numSegments > 0 ? numSegments : 1));
+    numSegments = 0;
+    for (pid = 0; pid < mgrPtr->numTables; pid++)
+       {
+        tablePtr = &mgrPtr->tables[ pid ];
+        for (index = 0; index < tablePtr->count; index++)
+           {
+            segmentPtrs[ numSegments++ ] = &tablePtr->segments[ index ];
+           }
+       }
+
+    // slide segments down in physical order
+    qsort(segmentPtrs, numSegments, sizeof(MemSegment*),
+                                                     &compareSegmentBases);
+    for (index = 0; index < numSegments; index++)
+       {
+        if (segmentPtrs[ index ]->physBase != nextBase)
+           {
+            segmentPtrs[ index ]->physBase = nextBase;
+            moved += segmentPtrs[ index ]->end - segmentPtrs[ index ]->start;
+           }
+        nextBase += segmentPtrs[ index ]->end - segmentPtrs[ index ]->start;
+       }
+    free(segmentPtrs);
+
+    // leave one hole above packed segments
+    mgrPtr->numHoles = 0;
+    if (nextBase < mgrPtr->memAvailable)
+       {
+        mgrPtr->holes[ 0 ].start = nextBase;
+        mgrPtr->holes[ 0 ].end = mgrPtr->memAvailable;
+        mgrPtr->numHoles = 1;
+       }
+
+    // count compaction and return bytes moved
+    mgrPtr->compactions++;
+    mgrPtr->bytesMoved += moved;
+    mgrPtr->lastMoved = moved;
+    return moved;
+   }
+
+/*
+ * Function Name: compareSegmentBases
+ * Algorithm: orders two segment pointers by physical base for qsort
+ * Precondition: given pointers to two segment pointers
+ * Postcondition: negative, zero, or positive returned
+ * Exceptions: none
+ * Notes: none
+ */
+int compareSegmentBases(const void *leftPtr, const void *rightPtr)
+   {
+    // initialize function/variables
+    int left = (*(MemSegment * const *)leftPtr)->physBase;
+    int right = (*(MemSegment * const *)rightPtr)->physBase;
+
+    return (left > right) - (left < right);
+   }
+
+/*
+ * Function Name: findHole
+ * Algorithm: scans holes in address order for one large enough: the first
+ *            for first fit, the smallest for best fit, and the largest for
+ *            worst fit
+ * Precondition: given memory manager with a placement policy, and size
+ * Postcondition: hole index returned, or NO_SEGMENT if no hole fits
+ * Exceptions: none
+ * Notes: equal sizes go to the lower address
+ */
+int findHole(MemoryMgr *mgrPtr, int size)
+   {
+    // initialize function/variables
+    int index = 0, holeSize, bestIndex = NO_SEGMENT, bestSize = 0;
+
+    // scan holes, stopping at the first that fits for first fit
+    while (index < mgrPtr->numHoles && (mgrPtr->fitCode != MEM_FIT_FIRST_CODE
+                                                  || bestIndex == NO_SEGMENT))
+       {
+        holeSize = mgrPtr->holes[ index ].end - mgrPtr->holes[ index ].start;
+        if (holeSize >= size
+            && (bestIndex == NO_SEGMENT
+                || (mgrPtr->fitCode == MEM_FIT_BEST_CODE
+                                                   && holeSize < bestSize)
+                || (mgrPtr->fitCode == MEM_FIT_WORST_CODE
+                                                   && holeSize > bestSize)))
+           {
+            bestIndex = index;
+            bestSize = holeSize;
+           }
+        index++;
+       }
+
+    // return chosen hole
+    return bestIndex;
+   }
+
+/*
+ * Function Name: findSegment
+ * Algorithm: binary search for the last segment whose start is at or
+ *            before the given address
+ * Precondition: given segment table and address
+ * Postcondition: segment index returned, or NO_SEGMENT if every segment
+ *                starts after the address
+ * Exceptions: none
+ * Notes: returned segment does not necessarily contain the address
+ */
+int findSegment(SegmentTable *tablePtr, int address)
+   {
+    // initialize function/variables
+    int low = 0, high = tablePtr->count, mid;
+
+    // narrow to first segment starting after address
+    while (low < high)
+       {
+        mid = low + (high - low) / 2;
+
+        if (tablePtr->segments[ mid ].start <= address)
+           {
+            low = mid + 1;
+           }
+        else
+           {
+            high = mid;
+           }
+       }
+
+    // return segment just before it
+    return low > 0 ? low - 1 : NO_SEGMENT;
+   }
+
+/*
+ * Function Name: freeHole
+ * Algorithm: finds where the freed range falls among the holes by binary
+ *            search, then merges it with the hole ending at its start
+ *            and the hole starting at its end, or inserts it as a new hole
+ * Precondition: given memory manager with a placement policy, and freed
+ *               physical range not overlapping any hole
+ * Postcondition: range is free, holes sorted and never adjacent
+ * Exceptions: none
+ * Notes: none
+ */
+void freeHole(MemoryMgr *mgrPtr, int start, int end)
+   {
+    // initialize function/variables
+    MemHole *holes = mgrPtr->holes;
+    int low = 0, high = mgrPtr->numHoles, mid;
+    Boolean joinsPrev, joinsNext;
+
+    // narrow to first hole starting after range
+    while (low < high)
+       {
+        mid = low + (high - low) / 2;
+
+        if (holes[ mid ].start <= start)
+           {
+            low = mid + 1;
+           }
+        else
+           {
+            high = mid;
+           }
+       }
+    joinsPrev = low > 0 && holes[ low - 1 ].end == start;
+    joinsNext = low < mgrPtr->numHoles && holes[ low ].start == end;
+
+    // merge with both neighbours, removing the upper one
+    if (joinsPrev == True && joinsNext == True)
+       {
+        holes[ low - 1 ].end = holes[ low ].end;
+        memmove(&holes[ low ], &holes[ low + 1 ],
+                            sizeof(MemHole) * (mgrPtr->numHoles - low - 1));
+        mgrPtr->numHoles--;
+       }
+
+    // merge with one neighbour
+    else if (joinsPrev == True)
+       {
+        holes[ low - 1 ].end = end;
+       }
+    else if (joinsNext == True)
+       {
+        holes[ low ].start = start;
+       }
+
+    // otherwise, insert new hole, growing storage when full
+    else
+       {
+        if (mgrPtr->numHoles == mgrPtr->holeCapacity)
+           {
+            mgrPtr->holeCapacity *= 2;
+            mgrPtr->holes = (MemHole*)realloc(mgrPtr->holes,
+                                     sizeof(MemHole) * mgrPtr->holeCapacity);
+            holes = mgrPtr->holes;
+           }
+        memmove(&holes[ low + 1 ], &holes[ low ],
+                                sizeof(MemHole) * (mgrPtr->numHoles - low));
+        holes[ low ].start = start;
+        holes[ low ].end = end;
+        mgrPtr->numHoles++;
+       }
+   }
+
+/*
+ * Function Name: initMemoryMgr
+ * Algorithm: sets up one empty segment table per process, and with a
+ *            placement policy one hole spanning all of physical memory
+ * Precondition: given manager storage, available memory in bytes, number
+ *               of processes, placement policy code, and flag allowing
+ *               compaction when no hole fits
+ * Postcondition: manager ready for use, no memory in use
+ * Exceptions: none
+ * Notes: table storage is allocated on each process's first segment
+ */
+void initMemoryMgr(MemoryMgr *mgrPtr, int memAvailable, int numProcs,
+                                              int fitCode, Boolean compaction)
+   {
+    // set empty tables and cleared counters
+    memset(mgrPtr, 0, sizeof(MemoryMgr));
+    mgrPtr->tables = (SegmentTable*)calloc(numProcs > 0 ? numProcs : 1,
+                                                        sizeof(SegmentTable));
+    mgrPtr->numTables = numProcs;
+    mgrPtr->memAvailable = memAvailable;
+    mgrPtr->fitCode = fitCode;
+    mgrPtr->compaction = compaction;
+
+    // start placing with all memory in one hole, if placing
+    if (fitCode != MEM_FIT_NONE_CODE)
+       {
+        mgrPtr->holeCapacity = INIT_HOLE_CAPACITY;
+        mgrPtr->holes = (MemHole*)malloc(sizeof(MemHole) * INIT_HOLE_CAPACITY);
+        if (memAvailable > 0)
+           {
+            mgrPtr->holes[ 0 ].start = 0;
+            mgrPtr->holes[ 0 ].end = memAvailable;
+            mgrPtr->numHoles = 1;
+           }
+       }
+   }
+
+/*
+ * Function Name: placeSegment
+ * Algorithm: finds a hole for the segment by the placement policy,
+ *            compacting first when allowed and no hole is large enough,
+ *            then takes the segment from the bottom of that hole
+ * Precondition: given memory manager with a placement policy, and size no
+ *               larger than the memory still free
+ * Postcondition: physical base returned, or NO_SEGMENT returned and the
+ *                failure counted if no hole fits
+ * Exceptions: none
+ * Notes: compaction always makes room, since the size fits in free memory
+ */
+int placeSegment(MemoryMgr *mgrPtr, int size)
+   {
+    // initialize function/variables
+    int index = findHole(mgrPtr, size), physBase;
+
+    // compact, if allowed, when free memory is split too finely
+    if (index == NO_SEGMENT && mgrPtr->compaction == True)
+       {
+        compactMemory(mgrPtr);
+        index = findHole(mgrPtr, size);
+       }
+
+    // check for no hole large enough
+    if (index == NO_SEGMENT)
+       {
+        mgrPtr->fitFailures++;
+        return NO_SEGMENT;
+       }
+
+    // take segment from bottom of hole, removing hole once used up
+    physBase = mgrPtr->holes[ index ].start;
+    mgrPtr->holes[ index ].start += size;
+    if (mgrPtr->holes[ index ].start == mgrPtr->holes[ index ].end)
+       {
+        memmove(&mgrPtr->holes[ index ], &mgrPtr->holes[ index + 1 ],
+                          sizeof(MemHole) * (mgrPtr->numHoles - index - 1));
+        mgrPtr->numHoles--;
+       }
+    mgrPtr->numPlaced++;
+
+    // return physical base
+    return physBase;
+   }
+
+/*
+ * Function Name: releaseProcessMemory
+ * Algorithm: returns the size of every segment in the process table to the
+ *            free pool, and its physical range to the holes when placing,
+ *            then releases the table storage
+ * Precondition: given memory manager and pid
+ * Postcondition: process owns no segments, bytes freed returned
+ * Exceptions: none
+ * Notes: called when a process ends or faults
+ */
+int releaseProcessMemory(MemoryMgr *mgrPtr, int pid)
+   {
+    // initialize function/variables
+    SegmentTable *tablePtr = &mgrPtr->tables[ pid ];
+    MemSegment *segmentPtr;
+    int index, size, freed = 0;
+
+    // total segment sizes, freeing each physical range if placed
+    for (index = 0; index < tablePtr->count; index++)
+       {
+        segmentPtr = &tablePtr->segments[ index ];
+        size = segmentPtr->end - segmentPtr->start;
+        if (mgrPtr->fitCode != MEM_FIT_NONE_CODE)
+           {
+            freeHole(mgrPtr, segmentPtr->physBase,
+                                                 segmentPtr->physBase + size);
+           }
+        freed += size;
+       }
+
+    // return memory to pool and release table storage
+    mgrPtr->memUsed -= freed;
+    free(tablePtr->segments);
+    tablePtr->segments = NULL;
+    tablePtr->count = 0;
+    tablePtr->capacity = 0;
+
+    // return bytes freed
+    return freed;
+   }
+
+/*
+ * Function Name: updateFragmentation
+ * Algorithm: adds the fragmentation held since the last update to its
+ *            time integral, then finds the current fragmentation as the
+ *            share of free memory outside the largest hole
+ * Precondition: given memory manager and time in seconds, called after
+ *               each allocation or release
+ * Postcondition: current, maximum, and integrated fragmentation updated
+ * Exceptions: none
+ * Notes: without a placement policy there are no holes, so nothing is
+ *        done; an update stamped before the last one adds no area
+ */
+void updateFragmentation(MemoryMgr *mgrPtr, double nowTime)
+   {
+    // initialize function/variables
+    int index, holeSize, largest = 0;
+    int freeBytes = mgrPtr->memAvailable - mgrPtr->memUsed;
+
+    // check for no placement
+    if (mgrPtr->fitCode == MEM_FIT_NONE_CODE)
+       {
+        return;
+       }
+
+    // add area since last update
+    if (nowTime > mgrPtr->fragTime)
+       {
+        mgrPtr->fragArea += mgrPtr->fragmentation
+                                            * (nowTime - mgrPtr->fragTime);
+        mgrPtr->fragTime = nowTime;
+       }
+
+    // find largest hole
+    for (index = 0; index < mgrPtr->numHoles; index++)
+       {
+        holeSize = mgrPtr->holes[ index ].end - mgrPtr->holes[ index ].start;
+        if (holeSize > largest)
+           {
+            largest = holeSize;
+           }
+       }
+
+    // set current and maximum fragmentation
+    mgrPtr->fragmentation = freeBytes > 0
+                              ? 1.0 - (double)largest / freeBytes : 0.0;
+    if (mgrPtr->fragmentation > mgrPtr->maxFragmentation)
+       {
+        mgrPtr->maxFragmentation = mgrPtr->fragmentation;
+       }
+   }
@@ -0,0 +1,96 @@
+// Preprocessor directive
+#ifndef MEMORY_MGR_H
+#define MEMORY_MGR_H
+
+// header files
+#include <stdlib.h>
+#include <string.h>
+#include "StringUtils.h"
+
+// global constants
+#define INIT_SEGMENT_CAPACITY 16
+#define INIT_HOLE_CAPACITY 16
+#define NO_SEGMENT -1
+
+// placement policies for segments in physical memory; none only counts
+// bytes in use, with no placement and so no fragmentation
+typedef enum
+   {
+    MEM_FIT_NONE_CODE,
+    MEM_FIT_FIRST_CODE,
+    MEM_FIT_BEST_CODE,
+    MEM_FIT_WORST_CODE
+   } MemFitCode;
+
+// allocated address range, end exclusive, and where it sits in physical
+// memory when segments are placed
+typedef struct MemSegment
+   {
+    int start;
+    int end;
+    int physBase;
+   } MemSegment;
+
+// free physical range, end exclusive
+typedef struct MemHole
+   {
+    int start;
+    int end;
+   } MemHole;
+
+// one process's segments kept sorted by start address; segments never
+// overlap, so both allocate and access checks reduce to one binary search
+typedef struct SegmentTable
+   {
+    MemSegment *segments;
+    int count;
+    int capacity;
+   } SegmentTable;
+
+// per-process address spaces indexed by pid, all drawing on the one pool
+// of available memory; with a placement policy each segment is also
+// placed in a hole of physical memory, holes kept sorted by address and
+// merged with their neighbours when freed, and external fragmentation,
+// the share of free memory outside the largest hole, is integrated over
+// time for its average; last moved is the bytes moved by the latest
+// compaction
+typedef struct MemoryMgr
+   {
+    SegmentTable *tables;
+    int numTables;
+    int memAvailable;
+    int memUsed;
+    int peakUsed;
+    int fitCode;
+    Boolean compaction;
+    MemHole *holes;
+    int numHoles;
+    int holeCapacity;
+    long numPlaced;
+    long fitFailures;
+    long sizeFailures;
+    long compactions;
+    long bytesMoved;
+    int lastMoved;
+    double fragmentation;
+    double maxFragmentation;
+    double fragArea;
+    double fragTime;
+   } MemoryMgr;
+
+// function prototypes
+Boolean accessSegment(MemoryMgr *mgrPtr, int pid, int start, int size);
+Boolean allocateSegment(MemoryMgr *mgrPtr, int pid, int start, int size);
+void clearMemoryMgr(MemoryMgr *mgrPtr);
+int compactMemory(MemoryMgr *mgrPtr);
+int compareSegmentBases(const void *leftPtr, const void *rightPtr);
+int findHole(MemoryMgr *mgrPtr, int size);
+int findSegment(SegmentTable *tablePtr, int address);
+void freeHole(MemoryMgr *mgrPtr, int start, int end);
+void initMemoryMgr(MemoryMgr *mgrPtr, int memAvailable, int numProcs,
+                                             int fitCode, Boolean compaction);
+int placeSegment(MemoryMgr *mgrPtr, int size);
+int releaseProcessMemory(MemoryMgr *mgrPtr, int pid);
+void updateFragmentation(MemoryMgr *mgrPtr, double nowTime);
+
+#endif // MEMORY_MGR_H
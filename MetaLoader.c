@@ -0,0 +1,441 @@
+// header files
+#include "MetaLoader.h"
+
+/*
+ * Function Name: addMappedOp
+ * Algorithm: splits a line's fields into command, device direction,
+ *            string argument (the fields before the first number), and up
+ *            to two numbers, decodes the op kind from its exact keywords,
+ *            and appends the op, recording process op ranges and cycle
+ *            totals and interning device names
+ * Precondition: given program under construction, line fields, line
+ *               number, device table capacity, open process flag, and
+ *               error message storage
+ * Postcondition: op appended and True returned, or False returned with
+ *                error message set and the program unchanged
+ * Exceptions: unknown command or keyword, missing device name, bad
+ *             number, or trailing fields return False
+ * Notes: only sys and app start and end, dev in and out, cpu process, and
+ *        mem allocate and access are accepted, so a line holds exactly one
+ *        op and the line count bounds the op count
+ */
+Boolean addMappedOp(SimProgram *programPtr, MetaToken *tokens,
+                     int numTokens, int lineNum, int *deviceCapacity,
+                                       Boolean *inProcess, char *errorMsg)
+   {
+    // initialize function/variables
+    int opIndex = programPtr->numOps;
+    int tokenIndex = 1, strFirst, numFirst, arg2 = 0, arg3 = 0;
+    Boolean isDevice = tokenEquals(&tokens[ 0 ], "dev");
+    Boolean singleWord, isStart, isEnd;
+    OpKind kind = OP_UNKNOWN;
+
+    // skip device direction, if device op
+    if (isDevice == True)
+       {
+        tokenIndex++;
+       }
+
+    // string argument runs up to first numeric field
+    strFirst = tokenIndex;
+    while (tokenIndex < numTokens
+               && (tokens[ tokenIndex ].start[ 0 ] < '0'
+                                    || tokens[ tokenIndex ].start[ 0 ] > '9'))
+       {
+        tokenIndex++;
+       }
+    numFirst = tokenIndex;
+    singleWord = numFirst == strFirst + 1;
+    isStart = singleWord && tokenEquals(&tokens[ strFirst ], "start");
+    isEnd = singleWord && tokenEquals(&tokens[ strFirst ], "end");
+
+    // read up to two numbers, with nothing after them
+    if ((tokenIndex < numTokens
+             && readTokenNumber(&tokens[ tokenIndex++ ], &arg2) == False)
+        || (tokenIndex < numTokens
+             && readTokenNumber(&tokens[ tokenIndex++ ], &arg3) == False)
+        || tokenIndex < numTokens)
+       {
+        sprintf(errorMsg, "Meta data line %d: bad number or extra fields",
+                                                                   lineNum);
+        return False;
+       }
+
+    // decode op kind from exact keywords
+    if (tokenEquals(&tokens[ 0 ], "sys") == True && isStart == True)
+       {
+        kind = OP_SYS_START;
+       }
+    else if (tokenEquals(&tokens[ 0 ], "sys") == True && isEnd == True)
+       {
+        kind = OP_SYS_END;
+       }
+    else if (tokenEquals(&tokens[ 0 ], "app") == True && isStart == True)
+       {
+        kind = OP_APP_START;
+       }
+    else if (tokenEquals(&tokens[ 0 ], "app") == True && isEnd == True)
+       {
+        kind = OP_APP_END;
+       }
+    else if (isDevice == True && numTokens > 1 && numFirst > strFirst)
+       {
+        if (tokenEquals(&tokens[ 1 ], "in") == True)
+           {
+            kind = OP_DEV_IN;
+           }
+        else if (tokenEquals(&tokens[ 1 ], "out") == True)
+           {
+            kind = OP_DEV_OUT;
+           }
+       }
+    else if (tokenEquals(&tokens[ 0 ], "cpu") == True && singleWord == True
+                  && tokenEquals(&tokens[ strFirst ], "process") == True)
+       {
+        kind = OP_CPU_PROCESS;
+       }
+    else if (tokenEquals(&tokens[ 0 ], "mem") == True && singleWord == True)
+       {
+        if (tokenEquals(&tokens[ strFirst ], "allocate") == True)
+           {
+            kind = OP_MEM_ALLOCATE;
+           }
+        else if (tokenEquals(&tokens[ strFirst ], "access") == True)
+           {
+            kind = OP_MEM_ACCESS;
+           }
+       }
+
+    // check for unknown op
+    if (kind == OP_UNKNOWN)
+       {
+        sprintf(errorMsg, "Meta data line %d: unknown op", lineNum);
+        return False;
+       }
+
+    // set op data
+    programPtr->opKind[ opIndex ] = (unsigned char)kind;
+    programPtr->opArg2[ opIndex ] = arg2;
+    programPtr->opArg3[ opIndex ] = arg3;
+    programPtr->opDevice[ opIndex ] = NO_DEVICE;
+
+    // check for device op, intern its name and mark a missing track
+    if (kind == OP_DEV_IN || kind == OP_DEV_OUT)
+       {
+        if (numTokens - numFirst < 2)
+           {
+            programPtr->opArg3[ opIndex ] = NO_TRACK;
+           }
+        programPtr->opDevice[ opIndex ] = (short)findMappedDevice(
+                   programPtr, tokens, strFirst, numFirst - 1, deviceCapacity);
+        if (*inProcess == True)
+           {
+            programPtr->procIoCycles[ programPtr->numProcs ] += arg2;
+           }
+       }
+
+    // check for cpu op within a process
+    else if (kind == OP_CPU_PROCESS && *inProcess == True)
+       {
+        programPtr->procCpuCycles[ programPtr->numProcs ] += arg2;
+       }
+
+    // check for start of process op range
+    else if (kind == OP_APP_START)
+       {
+        programPtr->procStartOp[ programPtr->numProcs ] = opIndex;
+        programPtr->procCpuCycles[ programPtr->numProcs ] = 0;
+        programPtr->procIoCycles[ programPtr->numProcs ] = 0;
+        *inProcess = True;
+       }
+
+    // check for end of process op range
+    else if (kind == OP_APP_END && *inProcess == True)
+       {
+        programPtr->procEndOp[ programPtr->numProcs ] = opIndex;
+        programPtr->numProcs++;
+        *inProcess = False;
+       }
+
+    // count op
+    programPtr->numOps++;
+    return True;
+   }
+
+/*
+ * Function Name: findMappedDevice
+ * Algorithm: joins the device name fields with single spaces into a
+ *            bounded local name, doubles the device table if it is full,
+ *            then interns the name
+ * Precondition: given program under construction, line fields, range of
+ *               device name fields, and device table capacity
+ * Postcondition: device index returned, table grown if needed
+ * Exceptions: none
+ * Notes: the only copy made per op is this short name; superseded tables
+ *        stay in the arena until the program is cleared
+ */
+int findMappedDevice(SimProgram *programPtr, MetaToken *tokens,
+                      int firstToken, int lastToken, int *deviceCapacity)
+   {
+    // initialize function/variables
+    char deviceName[ STD_STR_LEN ];
+    char (*newNames)[ STD_STR_LEN ];
+    int tokenIndex, length, nameLength = 0;
+
+    // join name fields
+    for (tokenIndex = firstToken; tokenIndex <= lastToken; tokenIndex++)
+       {
+        if (tokenIndex > firstToken && nameLength < STD_STR_LEN - 1)
+           {
+            deviceName[ nameLength++ ] = ' ';
+           }
+        length = tokens[ tokenIndex ].length;
+        if (length > STD_STR_LEN - 1 - nameLength)
+           {
+            length = STD_STR_LEN - 1 - nameLength;
+           }
+        memcpy(&deviceName[ nameLength ], tokens[ tokenIndex ].start,
+                                                                     length);
+        nameLength += length;
+       }
+    deviceName[ nameLength ] = NULL_CHAR;
+
+    // grow device table, if full
+    if (programPtr->numDevices == *deviceCapacity)
+       {
+        *deviceCapacity *= 2;
+        newNames = arenaAlloc(&programPtr->arena,
+                                        STD_STR_LEN * (*deviceCapacity));
+        memcpy(newNames, programPtr->deviceNames,
+                                    STD_STR_LEN * programPtr->numDevices);
+        programPtr->deviceNames = newNames;
+       }
+
+    // return interned index
+    return findProgramDevice(programPtr, deviceName);
+   }
+
+/*
+ * Function Name: mapProgramFile
+ * Algorithm: maps the meta data file read only, sizes every program array
+ *            from its line count, then decodes each line straight from the
+ *            mapping into the arrays in one pass, skipping blank lines and
+ *            the start and end framing lines
+ * Precondition: given program storage, meta data file name, and error
+ *               message storage
+ * Postcondition: program filled in and True returned, or False returned
+ *                with error message set and program cleared
+ * Exceptions: unreadable or empty file, malformed op, or a process with
+ *             no app end is reported and rejected
+ * Notes: replaces getMetaData and buildProgram for large files; no op list
+ *        is built and no field is copied except device names
+ */
+Boolean mapProgramFile(SimProgram *programPtr, char *fileName,
+                                                              char *errorMsg)
+   {
+    // initialize function/variables
+    MetaToken tokens[ MAX_META_TOKENS ];
+    struct stat fileStat;
+    const char *dataPtr, *endPtr, *linePtr, *lineEnd;
+    int fileDesc, numTokens, maxOps = 1, lineNum = 0;
+    int deviceCapacity = INIT_DEVICE_CAPACITY;
+    Boolean inProcess = False;
+
+    // set program to empty
+    initArena(&programPtr->arena, 0);
+    programPtr->numOps = 0;
+    programPtr->numProcs = 0;
+    programPtr->numDevices = 0;
+
+    // open and map file
+    fileDesc = open(fileName, O_RDONLY);
+    if (fileDesc == -1 || fstat(fileDesc, &fileStat) == -1
+                                                   || fileStat.st_size == 0)
+       {
+        sprintf(errorMsg, "Unable to read meta data file: %s", fileName);
+        if (fileDesc != -1)
+           {
+            close(fileDesc);
+           }
+        return False;
+       }
+    dataPtr = mmap(NULL, fileStat.st_size, PROT_READ, MAP_PRIVATE,
+                                                               fileDesc, 0);
+    close(fileDesc);
+    if (dataPtr == MAP_FAILED)
+       {
+        sprintf(errorMsg, "Unable to map meta data file: %s", fileName);
+        return False;
+       }
+    endPtr = dataPtr + fileStat.st_size;
+    madvise((void*)dataPtr, fileStat.st_size, MADV_SEQUENTIAL);
+
+    // bound op count by line count, as each line holds at most one op
+    for (linePtr = memchr(dataPtr, '\n', endPtr - dataPtr); linePtr != NULL;
+                  linePtr = memchr(linePtr + 1, '\n', endPtr - linePtr - 1))
+       {
+        maxOps++;
+       }
+
+    // allocate all program arrays from one arena
+    programPtr->opKind = arenaAlloc(&programPtr->arena, maxOps + 1);
+    programPtr->opDevice = arenaAlloc(&programPtr->arena,
+                                                 sizeof(short) * (maxOps + 1));
+    programPtr->opArg2 = arenaAlloc(&programPtr->arena,
+                                                   sizeof(int) * (maxOps + 1));
+    programPtr->opArg3 = arenaAlloc(&programPtr->arena,
+                                                   sizeof(int) * (maxOps + 1));
+    programPtr->procStartOp = arenaAlloc(&programPtr->arena,
+                                               sizeof(int) * (maxOps / 2 + 1));
+    programPtr->procEndOp = arenaAlloc(&programPtr->arena,
+                                               sizeof(int) * (maxOps / 2 + 1));
+    programPtr->procCpuCycles = arenaAlloc(&programPtr->arena,
+                                               sizeof(int) * (maxOps / 2 + 1));
+    programPtr->procIoCycles = arenaAlloc(&programPtr->arena,
+                                               sizeof(int) * (maxOps / 2 + 1));
+    programPtr->deviceNames = arenaAlloc(&programPtr->arena,
+                                               STD_STR_LEN * deviceCapacity);
+
+    // decode each line in place
+    for (linePtr = dataPtr; linePtr < endPtr; linePtr = lineEnd + 1)
+       {
+        lineEnd = memchr(linePtr, '\n', endPtr - linePtr);
+        if (lineEnd == NULL)
+           {
+            lineEnd = endPtr;
+           }
+        lineNum++;
+        numTokens = splitMetaLine(linePtr, lineEnd, tokens);
+
+        // skip blank and framing lines
+        if (numTokens == 0 || tokenEquals(&tokens[ 0 ], "Start") == True
+                              || tokenEquals(&tokens[ 0 ], "End") == True)
+           {
+            continue;
+           }
+
+        // check for overlong line or malformed op
+        if (numTokens > MAX_META_TOKENS)
+           {
+            sprintf(errorMsg, "Meta data line %d: too many fields", lineNum);
+           }
+        if (numTokens > MAX_META_TOKENS || addMappedOp(programPtr, tokens,
+                                    numTokens, lineNum, &deviceCapacity,
+                                            &inProcess, errorMsg) == False)
+           {
+            munmap((void*)dataPtr, fileStat.st_size);
+            clearProgram(programPtr);
+            return False;
+           }
+       }
+    munmap((void*)dataPtr, fileStat.st_size);
+
+    // check for process left open
+    if (inProcess == True)
+       {
+        sprintf(errorMsg, "Meta data process %d has no app end",
+                                                       programPtr->numProcs);
+        clearProgram(programPtr);
+        return False;
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: readTokenNumber
+ * Algorithm: converts a field of decimal digits to an int
+ * Precondition: given field and value storage
+ * Postcondition: value set and True returned, or False returned
+ * Exceptions: field with a non-digit or a value above INT_MAX returns
+ *             False
+ * Notes: fields are not terminated, so library conversions are not used
+ */
+Boolean readTokenNumber(MetaToken *tokenPtr, int *valuePtr)
+   {
+    // initialize function/variables
+    long value = 0;
+    int index;
+
+    // accumulate digits
+    for (index = 0; index < tokenPtr->length; index++)
+       {
+        if (tokenPtr->start[ index ] < '0' || tokenPtr->start[ index ] > '9')
+           {
+            return False;
+           }
+        value = value * 10 + (tokenPtr->start[ index ] - '0');
+        if (value > INT_MAX)
+           {
+            return False;
+           }
+       }
+
+    // set value
+    *valuePtr = (int)value;
+    return True;
+   }
+
+/*
+ * Function Name: splitMetaLine
+ * Algorithm: records the start and length of each run of characters
+ *            between separators (space, tab, carriage return, comma, or
+ *            semicolon)
+ * Precondition: given line start and end, and room for MAX_META_TOKENS
+ *               fields
+ * Postcondition: number of fields on the line returned, with at most
+ *                MAX_META_TOKENS recorded
+ * Exceptions: none
+ * Notes: a count above MAX_META_TOKENS marks an overlong line
+ */
+int splitMetaLine(const char *linePtr, const char *endPtr,
+                                                         MetaToken *tokens)
+   {
+    // initialize function/variables
+    const char *fieldPtr;
+    int numTokens = 0;
+
+    // loop across line
+    while (linePtr < endPtr)
+       {
+        // skip separators
+        if (*linePtr == ' ' || *linePtr == '\t' || *linePtr == '\r'
+                                       || *linePtr == ',' || *linePtr == ';')
+           {
+            linePtr++;
+            continue;
+           }
+
+        // find end of field, recording it if there is room
+        fieldPtr = linePtr;
+        while (linePtr < endPtr && *linePtr != ' ' && *linePtr != '\t'
+                && *linePtr != '\r' && *linePtr != ',' && *linePtr != ';')
+           {
+            linePtr++;
+           }
+        if (numTokens < MAX_META_TOKENS)
+           {
+            tokens[ numTokens ].start = fieldPtr;
+            tokens[ numTokens ].length = (int)(linePtr - fieldPtr);
+           }
+        numTokens++;
+       }
+
+    // return field count
+    return numTokens;
+   }
+
+/*
+ * Function Name: tokenEquals
+ * Algorithm: compares a field against a terminated word
+ * Precondition: given field and word
+ * Postcondition: True returned if they match exactly
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean tokenEquals(MetaToken *tokenPtr, const char *word)
+   {
+    return (int)strlen(word) == tokenPtr->length
+                  && memcmp(tokenPtr->start, word, tokenPtr->length) == 0;
+   }
@@ -0,0 +1,40 @@
+// Preprocessor directive
+#ifndef META_LOADER_H
+#define META_LOADER_H
+
+// header files
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "StringUtils.h"
+#include "SimProgram.h"
+
+// global constants
+#define MAX_META_TOKENS 16
+#define INIT_DEVICE_CAPACITY 8
+
+// one field of a meta data line, left in place in the mapped file
+typedef struct MetaToken
+   {
+    const char *start;
+    int length;
+   } MetaToken;
+
+// function prototypes
+Boolean addMappedOp(SimProgram *programPtr, MetaToken *tokens,
+                     int numTokens, int lineNum, int *deviceCapacity,
+                                       Boolean *inProcess, char *errorMsg);
+int findMappedDevice(SimProgram *programPtr, MetaToken *tokens,
+                     int firstToken, int lastToken, int *deviceCapacity);
+Boolean mapProgramFile(SimProgram *programPtr, char *fileName,
+                                                             char *errorMsg);
+Boolean readTokenNumber(MetaToken *tokenPtr, int *valuePtr);
+int splitMetaLine(const char *linePtr, const char *endPtr,
+                                                        MetaToken *tokens);
+Boolean tokenEquals(MetaToken *tokenPtr, const char *word);
+
+#endif // META_LOADER_H
@@ -0,0 +1,51 @@
+// header files
+#include "OpDecode.h"
+
+/*
+ * Function Name: decodeOpKind
+ * Algorithm: maps a command and its argument strings to an op kind
+ * Precondition: given command, in/out argument, and first string argument
+ * Postcondition: matching op kind returned, OP_UNKNOWN if none match
+ * Exceptions: none
+ * Notes: dev ops decode on direction alone, since the device name is free
+ *        text
+ */
+OpKind decodeOpKind(char *command, char *inOutArg, char *strArg1)
+   {
+    // check for system op
+    if (compareString(command, "sys") == STR_EQ)
+       {
+        return compareString(strArg1, "end") == STR_EQ
+                                               ? OP_SYS_END : OP_SYS_START;
+       }
+
+    // check for application op
+    if (compareString(command, "app") == STR_EQ)
+       {
+        return compareString(strArg1, "end") == STR_EQ
+                                               ? OP_APP_END : OP_APP_START;
+       }
+
+    // check for device op
+    if (compareString(command, "dev") == STR_EQ)
+       {
+        return compareString(inOutArg, "in") == STR_EQ
+                                                   ? OP_DEV_IN : OP_DEV_OUT;
+       }
+
+    // check for cpu op
+    if (compareString(command, "cpu") == STR_EQ)
+       {
+        return OP_CPU_PROCESS;
+       }
+
+    // check for memory op
+    if (compareString(command, "mem") == STR_EQ)
+       {
+        return compareString(strArg1, "allocate") == STR_EQ
+                                          ? OP_MEM_ALLOCATE : OP_MEM_ACCESS;
+       }
+
+    // unrecognized op
+    return OP_UNKNOWN;
+   }
@@ -0,0 +1,27 @@
+// Preprocessor directive
+#ifndef OP_DECODE_H
+#define OP_DECODE_H
+
+// header files
+#include "StringUtils.h"
+
+// op code kinds, decoded once from the command and argument strings so the
+// dispatcher can switch on a small integer
+typedef enum
+   {
+    OP_UNKNOWN,
+    OP_SYS_START,
+    OP_SYS_END,
+    OP_APP_START,
+    OP_APP_END,
+    OP_DEV_IN,
+    OP_DEV_OUT,
+    OP_CPU_PROCESS,
+    OP_MEM_ALLOCATE,
+    OP_MEM_ACCESS
+   } OpKind;
+
+// function prototypes
+OpKind decodeOpKind(char *command, char *inOutArg, char *strArg1);
+
+#endif // OP_DECODE_H
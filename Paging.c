@@ -0,0 +1,462 @@
+// header files
+#include "Paging.h"
+
+/*
+ * Function Name: accessPages
+ * Algorithm: checks the access range lies in the process address space,
+ *            then translates every page it touches, loading pages that are
+ *            not resident
+ * Precondition: given pager, pid, access start and size, and storage for
+ *               the number of page faults taken
+ * Postcondition: True returned if every page touched is mapped for the
+ *                process; fault count set
+ * Exceptions: none
+ * Notes: pages before an unmapped page are still translated; a zero size
+ *        access touches the page holding its start, which must lie in
+ *        the address space
+ */
+Boolean accessPages(PagingMgr *pagerPtr, int pid, int start, int size,
+                                                            int *faultsPtr)
+   {
+    // initialize function/variables
+    int *tablePtr = pagerPtr->pageTables[ pid ];
+    int page, lastPage;
+
+    // check for range outside address space or process with no pages
+    *faultsPtr = 0;
+    if (tablePtr == NULL || start < 0 || size < 0
+                                 || start >= pagerPtr->addressSpace
+                                 || start + size > pagerPtr->addressSpace)
+       {
+        return False;
+       }
+
+    // translate each page touched
+    lastPage = (start + (size > 0 ? size - 1 : 0)) / pagerPtr->pageSize;
+    for (page = start / pagerPtr->pageSize; page <= lastPage; page++)
+       {
+        // check for page never allocated to process
+        if (tablePtr[ page ] == PAGE_UNMAPPED)
+           {
+            return False;
+           }
+
+        translatePage(pagerPtr, pid, page, faultsPtr);
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: allocatePages
+ * Algorithm: maps every page the range touches into the process address
+ *            space without loading it, creating the page table on first use
+ * Precondition: given pager, pid, and range start and size
+ * Postcondition: pages mapped and True returned, or False if the range is
+ *                outside the address space
+ * Exceptions: none
+ * Notes: frames are assigned on first access (demand paging)
+ */
+Boolean allocatePages(PagingMgr *pagerPtr, int pid, int start, int size)
+   {
+    // initialize function/variables
+    int *tablePtr = pagerPtr->pageTables[ pid ];
+    int page, lastPage;
+
+    // check for range outside address space
+    if (start < 0 || size <= 0 || start + size > pagerPtr->addressSpace)
+       {
+        return False;
+       }
+
+    // create page table on first allocation
+    if (tablePtr == NULL)
+       {
+        tablePtr = (int*)malloc(sizeof(int) * pagerPtr->pagesPerProc);
+        for (page = 0; page < pagerPtr->pagesPerProc; page++)
+           {
+            tablePtr[ page ] = PAGE_UNMAPPED;
+           }
+        pagerPtr->pageTables[ pid ] = tablePtr;
+       }
+
+    // map each page touched, leaving resident pages alone
+    lastPage = (start + size - 1) / pagerPtr->pageSize;
+    for (page = start / pagerPtr->pageSize; page <= lastPage; page++)
+       {
+        if (tablePtr[ page ] == PAGE_UNMAPPED)
+           {
+            tablePtr[ page ] = PAGE_NOT_RESIDENT;
+           }
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: clearPagingMgr
+ * Algorithm: releases every process page table, then frame, TLB, and table
+ *            arrays
+ * Precondition: given initialized pager
+ * Postcondition: pager memory returned to OS
+ * Exceptions: none
+ * Notes: counters are left intact for reporting
+ */
+void clearPagingMgr(PagingMgr *pagerPtr)
+   {
+    // initialize function/variables
+    int pid;
+
+    // release each process page table
+    for (pid = 0; pid < pagerPtr->numProcs; pid++)
+       {
+        releaseProcessPages(pagerPtr, pid);
+       }
+
+    // release pager arrays
+    free(pagerPtr->pageTables);
+    free(pagerPtr->frames);
+    free(pagerPtr->tlb);
+    pagerPtr->pageTables = NULL;
+    pagerPtr->frames = NULL;
+    pagerPtr->tlb = NULL;
+   }
+
+/*
+ * Function Name: evictFrame
+ * Algorithm: picks a victim frame by the configured policy, marks its page
+ *            not resident, drops any TLB entry for it, and unlinks it
+ * Precondition: given pager with every frame in use
+ * Postcondition: victim frame number returned, ready for reuse
+ * Exceptions: none
+ * Notes: FIFO and LRU take the oldest linked frame; Clock sweeps the hand,
+ *        clearing reference bits until it finds an unreferenced frame
+ */
+int evictFrame(PagingMgr *pagerPtr)
+   {
+    // initialize function/variables
+    int victim = pagerPtr->oldestFrame;
+    FrameEntry *framePtr;
+    int index;
+
+    // check for clock policy
+    if (pagerPtr->replaceCode == PAGE_CLOCK_CODE)
+       {
+        // sweep hand, giving referenced frames a second chance
+        while (True)
+           {
+            victim = pagerPtr->clockHand;
+            pagerPtr->clockHand = (victim + 1) % pagerPtr->numFrames;
+
+            if (pagerPtr->frames[ victim ].referenced == False)
+               {
+                break;
+               }
+
+            pagerPtr->frames[ victim ].referenced = False;
+           }
+       }
+
+    // mark victim page not resident
+    framePtr = &pagerPtr->frames[ victim ];
+    pagerPtr->pageTables[ framePtr->pid ][ framePtr->page ] =
+                                                            PAGE_NOT_RESIDENT;
+
+    // drop cached translation
+    for (index = 0; index < pagerPtr->tlbEntries; index++)
+       {
+        if (pagerPtr->tlb[ index ].pid != NO_FRAME
+                                   && pagerPtr->tlb[ index ].frame == victim)
+           {
+            pagerPtr->tlb[ index ].pid = NO_FRAME;
+           }
+       }
+
+    // unlink victim and count eviction
+    unlinkFrame(pagerPtr, victim);
+    pagerPtr->evictions++;
+
+    // return victim frame
+    return victim;
+   }
+
+/*
+ * Function Name: initPagingMgr
+ * Algorithm: divides available memory into frames, places every frame on
+ *            the free stack, and empties the TLB
+ * Precondition: given pager storage, available memory, page size, TLB
+ *               size (zero for default), replacement policy code, and
+ *               number of processes
+ * Postcondition: pager ready for use, counters zeroed
+ * Exceptions: none
+ * Notes: each process address space is the size of available memory
+ */
+void initPagingMgr(PagingMgr *pagerPtr, int memAvailable, int pageSize,
+                       int tlbEntries, int replaceCode, int numProcs)
+   {
+    // initialize function/variables
+    int index;
+
+    // size address spaces and frame pool
+    pagerPtr->pageSize = pageSize;
+    pagerPtr->numFrames = memAvailable / pageSize > 0
+                                               ? memAvailable / pageSize : 1;
+    pagerPtr->pagesPerProc = pagerPtr->numFrames;
+    pagerPtr->addressSpace = pagerPtr->pagesPerProc * pageSize;
+    pagerPtr->numProcs = numProcs;
+    pagerPtr->pageTables = (int**)calloc(numProcs > 0 ? numProcs : 1,
+                                                                sizeof(int*));
+    pagerPtr->replaceCode = replaceCode;
+
+    // place every frame on free stack
+    pagerPtr->frames = (FrameEntry*)malloc(sizeof(FrameEntry)
+                                                     * pagerPtr->numFrames);
+    for (index = 0; index < pagerPtr->numFrames; index++)
+       {
+        pagerPtr->frames[ index ].pid = NO_FRAME;
+        pagerPtr->frames[ index ].nextFrame = index + 1;
+       }
+    pagerPtr->frames[ pagerPtr->numFrames - 1 ].nextFrame = NO_FRAME;
+    pagerPtr->freeFrame = 0;
+    pagerPtr->oldestFrame = NO_FRAME;
+    pagerPtr->newestFrame = NO_FRAME;
+    pagerPtr->clockHand = 0;
+
+    // empty TLB
+    pagerPtr->tlbEntries = tlbEntries > 0 ? tlbEntries : DEFAULT_TLB_ENTRIES;
+    pagerPtr->tlb = (TlbEntry*)malloc(sizeof(TlbEntry)
+                                                    * pagerPtr->tlbEntries);
+    for (index = 0; index < pagerPtr->tlbEntries; index++)
+       {
+        pagerPtr->tlb[ index ].pid = NO_FRAME;
+        pagerPtr->tlb[ index ].page = NO_FRAME;
+        pagerPtr->tlb[ index ].frame = NO_FRAME;
+        pagerPtr->tlb[ index ].lastUse = 0;
+       }
+
+    // zero counters
+    pagerPtr->useTick = 0;
+    pagerPtr->tlbHits = 0;
+    pagerPtr->tlbMisses = 0;
+    pagerPtr->pageFaults = 0;
+    pagerPtr->evictions = 0;
+   }
+
+/*
+ * Function Name: linkNewestFrame
+ * Algorithm: appends frame to the newest end of the in-use frame list
+ * Precondition: given pager and unlinked frame
+ * Postcondition: frame is newest in list
+ * Exceptions: none
+ * Notes: none
+ */
+void linkNewestFrame(PagingMgr *pagerPtr, int frame)
+   {
+    pagerPtr->frames[ frame ].prevFrame = pagerPtr->newestFrame;
+    pagerPtr->frames[ frame ].nextFrame = NO_FRAME;
+
+    if (pagerPtr->newestFrame == NO_FRAME)
+       {
+        pagerPtr->oldestFrame = frame;
+       }
+    else
+       {
+        pagerPtr->frames[ pagerPtr->newestFrame ].nextFrame = frame;
+       }
+
+    pagerPtr->newestFrame = frame;
+   }
+
+/*
+ * Function Name: loadPage
+ * Algorithm: takes a free frame, or evicts one when none are free, and
+ *            loads the page into it
+ * Precondition: given pager, pid, and mapped page that is not resident
+ * Postcondition: page resident, frame number returned
+ * Exceptions: none
+ * Notes: none
+ */
+int loadPage(PagingMgr *pagerPtr, int pid, int page)
+   {
+    // initialize function/variables
+    int frame = pagerPtr->freeFrame;
+
+    // check for free frame, otherwise evict one
+    if (frame != NO_FRAME)
+       {
+        pagerPtr->freeFrame = pagerPtr->frames[ frame ].nextFrame;
+       }
+    else
+       {
+        frame = evictFrame(pagerPtr);
+       }
+
+    // load page into frame
+    pagerPtr->frames[ frame ].pid = pid;
+    pagerPtr->frames[ frame ].page = page;
+    pagerPtr->frames[ frame ].referenced = True;
+    linkNewestFrame(pagerPtr, frame);
+    pagerPtr->pageTables[ pid ][ page ] = frame;
+
+    // return frame
+    return frame;
+   }
+
+/*
+ * Function Name: releaseProcessPages
+ * Algorithm: returns every resident frame of the process to the free
+ *            stack, drops its TLB entries, and releases its page table
+ * Precondition: given pager and pid
+ * Postcondition: process has no pages mapped
+ * Exceptions: none
+ * Notes: called when a process ends or faults
+ */
+void releaseProcessPages(PagingMgr *pagerPtr, int pid)
+   {
+    // initialize function/variables
+    int *tablePtr = pagerPtr->pageTables[ pid ];
+    int page, frame, index;
+
+    // check for process with no pages
+    if (tablePtr == NULL)
+       {
+        return;
+       }
+
+    // free each resident frame
+    for (page = 0; page < pagerPtr->pagesPerProc; page++)
+       {
+        frame = tablePtr[ page ];
+        if (frame >= 0)
+           {
+            unlinkFrame(pagerPtr, frame);
+            pagerPtr->frames[ frame ].pid = NO_FRAME;
+            pagerPtr->frames[ frame ].referenced = False;
+            pagerPtr->frames[ frame ].nextFrame = pagerPtr->freeFrame;
+            pagerPtr->freeFrame = frame;
+           }
+       }
+
+    // drop cached translations
+    for (index = 0; index < pagerPtr->tlbEntries; index++)
+       {
+        if (pagerPtr->tlb[ index ].pid == pid)
+           {
+            pagerPtr->tlb[ index ].pid = NO_FRAME;
+           }
+       }
+
+    // release page table
+    free(tablePtr);
+    pagerPtr->pageTables[ pid ] = NULL;
+   }
+
+/*
+ * Function Name: translatePage
+ * Algorithm: looks the page up in the TLB; on a miss walks the page table,
+ *            loading the page on a fault, and caches the translation in an
+ *            empty or least recently used TLB entry; then marks the frame
+ *            referenced and, under LRU, moves it to the newest end
+ * Precondition: given pager, pid, mapped page, and fault counter
+ * Postcondition: frame number returned, counters updated
+ * Exceptions: none
+ * Notes: none
+ */
+int translatePage(PagingMgr *pagerPtr, int pid, int page, int *faultsPtr)
+   {
+    // initialize function/variables
+    TlbEntry *tlb = pagerPtr->tlb;
+    int index, slot = 0, frame = NO_FRAME;
+
+    // search TLB, tracking replacement slot
+    pagerPtr->useTick++;
+    for (index = 0; index < pagerPtr->tlbEntries; index++)
+       {
+        if (tlb[ index ].pid == pid && tlb[ index ].page == page)
+           {
+            frame = tlb[ index ].frame;
+            tlb[ index ].lastUse = pagerPtr->useTick;
+            break;
+           }
+
+        if (tlb[ slot ].pid != NO_FRAME && (tlb[ index ].pid == NO_FRAME
+                               || tlb[ index ].lastUse < tlb[ slot ].lastUse))
+           {
+            slot = index;
+           }
+       }
+
+    // check for TLB hit
+    if (frame != NO_FRAME)
+       {
+        pagerPtr->tlbHits++;
+       }
+
+    // otherwise, walk page table, loading page on fault
+    else
+       {
+        pagerPtr->tlbMisses++;
+        frame = pagerPtr->pageTables[ pid ][ page ];
+        if (frame == PAGE_NOT_RESIDENT)
+           {
+            frame = loadPage(pagerPtr, pid, page);
+            pagerPtr->pageFaults++;
+            (*faultsPtr)++;
+           }
+
+        // cache translation
+        tlb[ slot ].pid = pid;
+        tlb[ slot ].page = page;
+        tlb[ slot ].frame = frame;
+        tlb[ slot ].lastUse = pagerPtr->useTick;
+       }
+
+    // record reference
+    pagerPtr->frames[ frame ].referenced = True;
+    if (pagerPtr->replaceCode == PAGE_LRU_CODE
+                                         && frame != pagerPtr->newestFrame)
+       {
+        unlinkFrame(pagerPtr, frame);
+        linkNewestFrame(pagerPtr, frame);
+       }
+
+    // return frame
+    return frame;
+   }
+
+/*
+ * Function Name: unlinkFrame
+ * Algorithm: removes frame from the in-use frame list
+ * Precondition: given pager and linked frame
+ * Postcondition: neighbours joined, list ends updated
+ * Exceptions: none
+ * Notes: none
+ */
+void unlinkFrame(PagingMgr *pagerPtr, int frame)
+   {
+    // initialize function/variables
+    int prevFrame = pagerPtr->frames[ frame ].prevFrame;
+    int nextFrame = pagerPtr->frames[ frame ].nextFrame;
+
+    // join previous frame to next
+    if (prevFrame == NO_FRAME)
+       {
+        pagerPtr->oldestFrame = nextFrame;
+       }
+    else
+       {
+        pagerPtr->frames[ prevFrame ].nextFrame = nextFrame;
+       }
+
+    // join next frame to previous
+    if (nextFrame == NO_FRAME)
+       {
+        pagerPtr->newestFrame = prevFrame;
+       }
+    else
+       {
+        pagerPtr->frames[ nextFrame ].prevFrame = prevFrame;
+       }
+   }
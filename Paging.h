@@ -0,0 +1,83 @@
+// Preprocessor directive
+#ifndef PAGING_H
+#define PAGING_H
+
+// header files
+#include <stdlib.h>
+#include "StringUtils.h"
+
+// global constants
+#define PAGE_UNMAPPED -2
+#define PAGE_NOT_RESIDENT -1
+#define NO_FRAME -1
+#define DEFAULT_TLB_ENTRIES 16
+
+// page replacement policies
+typedef enum
+   {
+    PAGE_FIFO_CODE,
+    PAGE_LRU_CODE,
+    PAGE_CLOCK_CODE
+   } PageReplaceCode;
+
+// physical frame; frames in use are linked oldest first, in load order
+// for FIFO and in use order for LRU, free frames are linked as a stack
+typedef struct FrameEntry
+   {
+    int pid;
+    int page;
+    int prevFrame;
+    int nextFrame;
+    Boolean referenced;
+   } FrameEntry;
+
+// cached translation; pid of NO_FRAME marks an empty entry
+typedef struct TlbEntry
+   {
+    int pid;
+    int page;
+    int frame;
+    long lastUse;
+   } TlbEntry;
+
+// demand-paged memory; each process has a lazily allocated page table
+// whose entries hold a frame number, or mark the page not resident or
+// not mapped
+typedef struct PagingMgr
+   {
+    int pageSize;
+    int pagesPerProc;
+    int addressSpace;
+    int numProcs;
+    int **pageTables;
+    int numFrames;
+    FrameEntry *frames;
+    int oldestFrame;
+    int newestFrame;
+    int freeFrame;
+    int clockHand;
+    int replaceCode;
+    TlbEntry *tlb;
+    int tlbEntries;
+    long useTick;
+    long tlbHits;
+    long tlbMisses;
+    long pageFaults;
+    long evictions;
+   } PagingMgr;
+
+// function prototypes
+Boolean accessPages(PagingMgr *pagerPtr, int pid, int start, int size,
+                                                           int *faultsPtr);
+Boolean allocatePages(PagingMgr *pagerPtr, int pid, int start, int size);
+void clearPagingMgr(PagingMgr *pagerPtr);
+int evictFrame(PagingMgr *pagerPtr);
+void initPagingMgr(PagingMgr *pagerPtr, int memAvailable, int pageSize,
+                      int tlbEntries, int replaceCode, int numProcs);
+void linkNewestFrame(PagingMgr *pagerPtr, int frame);
+int loadPage(PagingMgr *pagerPtr, int pid, int page);
+void releaseProcessPages(PagingMgr *pagerPtr, int pid);
+int translatePage(PagingMgr *pagerPtr, int pid, int page, int *faultsPtr);
+void unlinkFrame(PagingMgr *pagerPtr, int frame);
+
+#endif // PAGING_H
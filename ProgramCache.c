@@ -0,0 +1,283 @@
+// header files
+#include "ProgramCache.h"
+
+/*
+ * Function Name: loadCachedProgram
+ * Algorithm: loads the program from the cache file beside the config's
+ *            meta data file when that cache is current; otherwise maps the
+ *            meta data file and saves a new cache for later runs
+ * Precondition: given program storage, loaded config, cache hit flag
+ *               storage, and error message storage
+ * Postcondition: program filled in, cache hit flag set, and True returned,
+ *                or False returned with error message set
+ * Exceptions: unreadable or malformed meta data is reported and rejected;
+ *             a cache that cannot be written is ignored
+ * Notes: the source file is examined before it is read, so a file changed
+ *        while loading leaves a cache that is seen as stale
+ */
+Boolean loadCachedProgram(SimProgram *programPtr, ConfigDataType *configPtr,
+                                      Boolean *fromCachePtr, char *errorMsg)
+   {
+    // initialize function/variables
+    char cacheName[ LARGE_STR_LEN + STD_STR_LEN ];
+    struct stat sourceStat;
+    Boolean sourceFound;
+
+    // name cache after meta data file
+    copyString(cacheName, configPtr->metaDataFileName);
+    strcat(cacheName, CACHE_SUFFIX);
+
+    // check for current cache
+    sourceFound = stat(configPtr->metaDataFileName, &sourceStat) == 0;
+    *fromCachePtr = sourceFound == True
+                    && loadProgramCache(cacheName, &sourceStat, programPtr);
+    if (*fromCachePtr == True)
+       {
+        return True;
+       }
+
+    // load meta data file, then save cache
+    if (mapProgramFile(programPtr, configPtr->metaDataFileName,
+                                                          errorMsg) == False)
+       {
+        return False;
+       }
+    if (sourceFound == True)
+       {
+        saveProgramCache(cacheName, &sourceStat, programPtr);
+       }
+    return True;
+   }
+
+/*
+ * Function Name: loadProgramCache
+ * Algorithm: reads and checks the cache header against this build's
+ *            layout and the source file's size and modification time, and
+ *            the cache size against the header's array sizes, then reads
+ *            every program array into a new program arena
+ * Precondition: given cache file name, status of the meta data file it
+ *               was built from, and program storage
+ * Postcondition: program filled in and True returned, or False returned
+ *                with program cleared
+ * Exceptions: missing, stale, foreign, or truncated cache returns False
+ * Notes: the cache holds only the program, which does not depend on the
+ *        config, so one cache serves every config naming its source
+ */
+Boolean loadProgramCache(char *cacheName, struct stat *sourceStatPtr,
+                                                     SimProgram *programPtr)
+   {
+    // initialize function/variables
+    FILE *filePtr = fopen(cacheName, "rb");
+    CacheHeader header, expected;
+    struct stat cacheStat;
+    Boolean readOk = True;
+    long long expectedSize;
+    int numOps, numProcs;
+
+    // check for cache not found
+    if (filePtr == NULL)
+       {
+        return False;
+       }
+
+    // check header against this layout and the source file
+    setCacheHeader(&expected, sourceStatPtr, NULL);
+    if (fread(&header, sizeof(CacheHeader), 1, filePtr) != 1
+        || memcmp(header.magic, CACHE_MAGIC, CACHE_MAGIC_LEN) != 0
+        || header.version != expected.version
+        || header.byteOrder != expected.byteOrder
+        || header.headerSize != expected.headerSize
+        || header.sourceSize != expected.sourceSize
+        || header.sourceSeconds != expected.sourceSeconds
+        || header.sourceNanoseconds != expected.sourceNanoseconds
+        || header.numOps < 0 || header.numProcs < 0
+        || header.numDevices < 0)
+       {
+        fclose(filePtr);
+        return False;
+       }
+    numOps = header.numOps;
+    numProcs = header.numProcs;
+
+    // check cache holds exactly the arrays its header gives
+    expectedSize = (long long)sizeof(CacheHeader)
+           + (long long)numOps * (long long)(sizeof(unsigned char)
+                                         + sizeof(short) + 2 * sizeof(int))
+           + (long long)numProcs * (long long)(4 * sizeof(int))
+           + (long long)header.numDevices * STD_STR_LEN;
+    if (fstat(fileno(filePtr), &cacheStat) == -1
+                           || (long long)cacheStat.st_size != expectedSize)
+       {
+        fclose(filePtr);
+        return False;
+       }
+
+    // read every array into a new arena
+    initArena(&programPtr->arena, 0);
+    programPtr->numOps = numOps;
+    programPtr->numProcs = numProcs;
+    programPtr->numDevices = header.numDevices;
+    programPtr->opKind = readCacheArray(filePtr, &programPtr->arena,
+                                    sizeof(unsigned char), numOps, &readOk);
+    programPtr->opDevice = readCacheArray(filePtr, &programPtr->arena,
+                                            sizeof(short), numOps, &readOk);
+    programPtr->opArg2 = readCacheArray(filePtr, &programPtr->arena,
+                                              sizeof(int), numOps, &readOk);
+    programPtr->opArg3 = readCacheArray(filePtr, &programPtr->arena,
+                                              sizeof(int), numOps, &readOk);
+    programPtr->procStartOp = readCacheArray(filePtr, &programPtr->arena,
+                                            sizeof(int), numProcs, &readOk);
+    programPtr->procEndOp = readCacheArray(filePtr, &programPtr->arena,
+                                            sizeof(int), numProcs, &readOk);
+    programPtr->procCpuCycles = readCacheArray(filePtr, &programPtr->arena,
+                                            sizeof(int), numProcs, &readOk);
+    programPtr->procIoCycles = readCacheArray(filePtr, &programPtr->arena,
+                                            sizeof(int), numProcs, &readOk);
+    programPtr->deviceNames = readCacheArray(filePtr, &programPtr->arena,
+                                  STD_STR_LEN, header.numDevices, &readOk);
+    fclose(filePtr);
+
+    // check for truncated cache
+    if (readOk == False)
+       {
+        clearProgram(programPtr);
+        return False;
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: readCacheArray
+ * Algorithm: allocates an array from the arena, with one spare element as
+ *            buildProgram allows, and reads its elements from the cache
+ * Precondition: given open cache positioned at the array, program arena,
+ *               element size and count, and read status
+ * Postcondition: array returned; read status set to False on a short read
+ * Exceptions: none
+ * Notes: a failed earlier read skips this one
+ */
+void *readCacheArray(FILE *filePtr, Arena *arenaPtr, size_t elementSize,
+                                                   int count, Boolean *readOk)
+   {
+    // initialize function/variables
+    void *arrayPtr = arenaAlloc(arenaPtr, elementSize * (count + 1));
+
+    // read elements, if no earlier read failed
+    if (*readOk == True && count > 0
+           && fread(arrayPtr, elementSize, count, filePtr) != (size_t)count)
+       {
+        *readOk = False;
+       }
+
+    // return array
+    return arrayPtr;
+   }
+
+/*
+ * Function Name: saveProgramCache
+ * Algorithm: writes the header and every program array to a temporary
+ *            file beside the cache, then renames it over the cache
+ * Precondition: given cache file name, status of the meta data file the
+ *               program was built from, and built program
+ * Postcondition: cache written and True returned, or False returned with
+ *                any existing cache left in place
+ * Exceptions: file that cannot be created or written returns False
+ * Notes: the rename makes the new cache appear whole, so simulations
+ *        sharing one meta data file may save and load it concurrently
+ */
+Boolean saveProgramCache(char *cacheName, struct stat *sourceStatPtr,
+                                                     SimProgram *programPtr)
+   {
+    // initialize function/variables
+    char tempName[ LARGE_STR_LEN + STD_STR_LEN ];
+    CacheHeader header;
+    FILE *filePtr;
+    int fileDesc, numOps = programPtr->numOps;
+    int numProcs = programPtr->numProcs;
+    Boolean writeOk;
+
+    // create temporary file
+    copyString(tempName, cacheName);
+    strcat(tempName, CACHE_TEMP_SUFFIX);
+    fileDesc = mkstemp(tempName);
+    if (fileDesc == -1)
+       {
+        return False;
+       }
+    filePtr = fdopen(fileDesc, "wb");
+    if (filePtr == NULL)
+       {
+        close(fileDesc);
+        remove(tempName);
+        return False;
+       }
+
+    // write header and arrays
+    setCacheHeader(&header, sourceStatPtr, programPtr);
+    writeOk = fwrite(&header, sizeof(CacheHeader), 1, filePtr) == 1
+       && fwrite(programPtr->opKind, sizeof(unsigned char), numOps,
+                                               filePtr) == (size_t)numOps
+       && fwrite(programPtr->opDevice, sizeof(short), numOps,
+                                               filePtr) == (size_t)numOps
+       && fwrite(programPtr->opArg2, sizeof(int), numOps,
+                                               filePtr) == (size_t)numOps
+       && fwrite(programPtr->opArg3, sizeof(int), numOps,
+                                               filePtr) == (size_t)numOps
+       && fwrite(programPtr->procStartOp, sizeof(int), numProcs,
+                                               filePtr) == (size_t)numProcs
+       && fwrite(programPtr->procEndOp, sizeof(int), numProcs,
+                                               filePtr) == (size_t)numProcs
+       && fwrite(programPtr->procCpuCycles, sizeof(int), numProcs,
+                                               filePtr) == (size_t)numProcs
+       && fwrite(programPtr->procIoCycles, sizeof(int), numProcs,
+                                               filePtr) == (size_t)numProcs
+       && fwrite(programPtr->deviceNames, STD_STR_LEN,
+                       programPtr->numDevices, filePtr)
+                                           == (size_t)programPtr->numDevices;
+
+    // close file, then replace cache or discard partial file
+    writeOk = fclose(filePtr) == 0 && writeOk;
+    if (writeOk == False || rename(tempName, cacheName) != 0)
+       {
+        remove(tempName);
+        return False;
+       }
+
+    // return success
+    return True;
+   }
+
+/*
+ * Function Name: setCacheHeader
+ * Algorithm: fills in the format identity, this build's layout checks,
+ *            the source file's size and modification time, and the
+ *            program's array sizes
+ * Precondition: given header storage, source file status, and program,
+ *               NULL when only the identity and source are needed
+ * Postcondition: header filled in
+ * Exceptions: none
+ * Notes: none
+ */
+void setCacheHeader(CacheHeader *headerPtr, struct stat *sourceStatPtr,
+                                                       SimProgram *programPtr)
+   {
+    // set format identity and source
+    memset(headerPtr, 0, sizeof(CacheHeader));
+    memcpy(headerPtr->magic, CACHE_MAGIC, CACHE_MAGIC_LEN);
+    headerPtr->version = CACHE_VERSION;
+    headerPtr->byteOrder = CACHE_BYTE_ORDER;
+    headerPtr->headerSize = (int)sizeof(CacheHeader);
+    headerPtr->sourceSize = (long long)sourceStatPtr->st_size;
+    headerPtr->sourceSeconds = (long long)sourceStatPtr->st_mtim.tv_sec;
+    headerPtr->sourceNanoseconds = (long long)sourceStatPtr->st_mtim.tv_nsec;
+
+    // set array sizes, if program given
+    if (programPtr != NULL)
+       {
+        headerPtr->numOps = programPtr->numOps;
+        headerPtr->numProcs = programPtr->numProcs;
+        headerPtr->numDevices = programPtr->numDevices;
+       }
+   }
@@ -0,0 +1,52 @@
+// Preprocessor directive
+#ifndef PROGRAM_CACHE_H
+#define PROGRAM_CACHE_H
+
+// header files
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "StringUtils.h"
+#include "configops.h"
+#include "SimProgram.h"
+#include "MetaLoader.h"
+
+// global constants
+#define CACHE_MAGIC "OSSIMPRG"
+#define CACHE_MAGIC_LEN 8
+#define CACHE_VERSION 3
+#define CACHE_BYTE_ORDER 0x01020304
+#define CACHE_SUFFIX ".simc"
+#define CACHE_TEMP_SUFFIX ".XXXXXX"
+
+// fixed start of a cache file; identifies the format and layout, the
+// meta data file the program was built from, and the array sizes that
+// follow it
+typedef struct CacheHeader
+   {
+    char magic[ CACHE_MAGIC_LEN ];
+    int version;
+    int byteOrder;
+    int headerSize;
+    int numOps;
+    int numProcs;
+    int numDevices;
+    long long sourceSize;
+    long long sourceSeconds;
+    long long sourceNanoseconds;
+   } CacheHeader;
+
+// function prototypes
+Boolean loadCachedProgram(SimProgram *programPtr, ConfigDataType *configPtr,
+                                     Boolean *fromCachePtr, char *errorMsg);
+Boolean loadProgramCache(char *cacheName, struct stat *sourceStatPtr,
+                                                    SimProgram *programPtr);
+void *readCacheArray(FILE *filePtr, Arena *arenaPtr, size_t elementSize,
+                                                  int count, Boolean *readOk);
+Boolean saveProgramCache(char *cacheName, struct stat *sourceStatPtr,
+                                                    SimProgram *programPtr);
+void setCacheHeader(CacheHeader *headerPtr, struct stat *sourceStatPtr,
+                                                      SimProgram *programPtr);
+
+#endif // PROGRAM_CACHE_H
@@ -0,0 +1,287 @@
+// header files
+#include "ReadyQueue.h"
+
+/*
+ * Function Name: clearReadyQueue
+ * Algorithm: returns heap and ring storage to OS and resets queue to empty
+ * Precondition: given initialized queue
+ * Postcondition: queue empty, storage released
+ * Exceptions: none
+ * Notes: queued data pointers are not freed
+ */
+void clearReadyQueue(ReadyQueue *queuePtr)
+   {
+    // initialize function/variables
+    int level;
+
+    // release heap and each level's ring
+    clearEventQueue(&queuePtr->heap);
+    for (level = 0; level < queuePtr->numLevels; level++)
+       {
+        free(queuePtr->rings[ level ].entries);
+       }
+    free(queuePtr->rings);
+    queuePtr->rings = NULL;
+    queuePtr->numLevels = 0;
+    queuePtr->levelMask = 0;
+   }
+
+/*
+ * Function Name: initReadyQueue
+ * Algorithm: sets queue to empty with one ring per priority level and no
+ *            entry storage allocated
+ * Precondition: given queue storage, flag selecting heap order over FIFO
+ *               order, and number of priority levels, 1 for a single FIFO
+ * Postcondition: queue ready for use
+ * Exceptions: none
+ * Notes: level count is clamped to 1 through MAX_READY_LEVELS; entry
+ *        storage is allocated on first push
+ */
+void initReadyQueue(ReadyQueue *queuePtr, Boolean heapOrder, int numLevels)
+   {
+    // clamp level count
+    if (numLevels < 1)
+       {
+        numLevels = 1;
+       }
+    else if (numLevels > MAX_READY_LEVELS)
+       {
+        numLevels = MAX_READY_LEVELS;
+       }
+
+    // set empty heap and rings
+    queuePtr->heapOrder = heapOrder;
+    initEventQueue(&queuePtr->heap);
+    queuePtr->rings = (ReadyRing*)calloc(numLevels, sizeof(ReadyRing));
+    queuePtr->numLevels = numLevels;
+    queuePtr->levelMask = 0;
+   }
+
+/*
+ * Function Name: popReady
+ * Algorithm: removes the entry with the smallest key in heap order, or the
+ *            oldest entry of the highest priority level holding any in
+ *            FIFO order, found from the lowest set bit of the level mask
+ * Precondition: given initialized queue
+ * Postcondition: entry data returned, or NULL if queue is empty
+ * Exceptions: none
+ * Notes: equal keys pop in the order they were pushed
+ */
+void *popReady(ReadyQueue *queuePtr)
+   {
+    // initialize function/variables
+    SimEvent entry;
+    void *dataPtr;
+    int level;
+
+    // check for heap order
+    if (queuePtr->heapOrder == True)
+       {
+        if (popEvent(&queuePtr->heap, &entry) == True)
+           {
+            return entry.dataPtr;
+           }
+
+        return NULL;
+       }
+
+    // check for every level empty
+    if (queuePtr->levelMask == 0)
+       {
+        return NULL;
+       }
+
+    // take oldest entry of highest level, clearing its bit once empty
+    level = __builtin_ctz(queuePtr->levelMask);
+    dataPtr = popRing(&queuePtr->rings[ level ]);
+    if (queuePtr->rings[ level ].count == 0)
+       {
+        queuePtr->levelMask &= ~(1u << level);
+       }
+
+    // return entry
+    return dataPtr;
+   }
+
+/*
+ * Function Name: popRing
+ * Algorithm: takes the entry at the ring head
+ * Precondition: given ring holding at least one entry
+ * Postcondition: oldest entry removed and returned
+ * Exceptions: none
+ * Notes: none
+ */
+void *popRing(ReadyRing *ringPtr)
+   {
+    // initialize function/variables
+    void *dataPtr = ringPtr->entries[ ringPtr->head ];
+
+    // advance head
+    ringPtr->head = (ringPtr->head + 1) % ringPtr->capacity;
+    ringPtr->count--;
+
+    // return oldest entry
+    return dataPtr;
+   }
+
+/*
+ * Function Name: pushReady
+ * Algorithm: adds an entry to the heap keyed by the given sort key, or to
+ *            the tail of the ring for the priority level given by the sort
+ *            key, setting that level's mask bit
+ * Precondition: given initialized queue, entry data, and sort key
+ * Postcondition: entry queued
+ * Exceptions: none
+ * Notes: in FIFO order the key is the level, 0 highest, clamped to the
+ *        queue's levels, so a single level queue ignores it
+ */
+void pushReady(ReadyQueue *queuePtr, void *dataPtr, double sortKey)
+   {
+    // initialize function/variables
+    int level = 0;
+
+    // check for heap order
+    if (queuePtr->heapOrder == True)
+       {
+        pushEvent(&queuePtr->heap, sortKey, dataPtr);
+        return;
+       }
+
+    // find level, clamped to queue's levels, and append at its ring tail
+    if (queuePtr->numLevels > 1 && sortKey > 0.0)
+       {
+        level = sortKey < queuePtr->numLevels
+                                 ? (int)sortKey : queuePtr->numLevels - 1;
+       }
+    pushRing(&queuePtr->rings[ level ], dataPtr);
+    queuePtr->levelMask |= 1u << level;
+   }
+
+/*
+ * Function Name: pushRing
+ * Algorithm: appends an entry at the ring tail, doubling storage when full
+ * Precondition: given ring and entry data
+ * Postcondition: entry queued
+ * Exceptions: none
+ * Notes: none
+ */
+void pushRing(ReadyRing *ringPtr, void *dataPtr)
+   {
+    // initialize function/variables
+    void **newEntries;
+    int newCapacity, index;
+
+    // grow ring when full, unwrapping entries into new storage
+    if (ringPtr->count == ringPtr->capacity)
+       {
+        newCapacity = ringPtr->capacity == 0
+                               ? INIT_READY_CAPACITY : ringPtr->capacity * 2;
+        newEntries = (void**)malloc(sizeof(void*) * newCapacity);
+        for (index = 0; index < ringPtr->count; index++)
+           {
+            newEntries[ index ] = ringPtr->entries[ (ringPtr->head + index)
+                                                       % ringPtr->capacity ];
+           }
+        free(ringPtr->entries);
+        ringPtr->entries = newEntries;
+        ringPtr->head = 0;
+        ringPtr->capacity = newCapacity;
+       }
+
+    // append at ring tail
+    ringPtr->entries[ (ringPtr->head + ringPtr->count)
+                                         % ringPtr->capacity ] = dataPtr;
+    ringPtr->count++;
+   }
+
+/*
+ * Function Name: raiseReadyLevels
+ * Algorithm: moves every entry below the top level to the top level's
+ *            tail, higher levels first and each in FIFO order
+ * Precondition: given initialized queue
+ * Postcondition: every queued entry at the top level; number moved
+ *                returned
+ * Exceptions: none
+ * Notes: heap order and single level queues have nothing to move
+ */
+int raiseReadyLevels(ReadyQueue *queuePtr)
+   {
+    // initialize function/variables
+    int level, numMoved = 0;
+    ReadyRing *ringPtr;
+
+    // drain each lower level onto top level
+    for (level = 1; level < queuePtr->numLevels; level++)
+       {
+        ringPtr = &queuePtr->rings[ level ];
+        while (ringPtr->count > 0)
+           {
+            pushRing(&queuePtr->rings[ 0 ], popRing(ringPtr));
+            numMoved++;
+           }
+       }
+
+    // update mask for entries moved
+    if (numMoved > 0)
+       {
+        queuePtr->levelMask = 1u;
+       }
+
+    // return count moved
+    return numMoved;
+   }
+
+/*
+ * Function Name: readyCount
+ * Algorithm: reports number of queued entries
+ * Precondition: given initialized queue
+ * Postcondition: entry count returned
+ * Exceptions: none
+ * Notes: none
+ */
+int readyCount(ReadyQueue *queuePtr)
+   {
+    // initialize function/variables
+    int level, count = 0;
+
+    // check for heap order
+    if (queuePtr->heapOrder == True)
+       {
+        return queuePtr->heap.count;
+       }
+
+    // sum level counts
+    for (level = 0; level < queuePtr->numLevels; level++)
+       {
+        count += queuePtr->rings[ level ].count;
+       }
+    return count;
+   }
+
+/*
+ * Function Name: topReadyLevel
+ * Algorithm: finds the highest priority level holding entries from the
+ *            lowest set bit of the level mask
+ * Precondition: given initialized queue
+ * Postcondition: level returned, 0 highest, or the number of levels if
+ *                the queue is empty
+ * Exceptions: none
+ * Notes: heap order queues report their single level, 0, when not empty
+ */
+int topReadyLevel(ReadyQueue *queuePtr)
+   {
+    // check for heap order
+    if (queuePtr->heapOrder == True)
+       {
+        return queuePtr->heap.count > 0 ? 0 : queuePtr->numLevels;
+       }
+
+    // check for every level empty
+    if (queuePtr->levelMask == 0)
+       {
+        return queuePtr->numLevels;
+       }
+
+    // return highest level in use
+    return __builtin_ctz(queuePtr->levelMask);
+   }
@@ -0,0 +1,47 @@
+// Preprocessor directive
+#ifndef READY_QUEUE_H
+#define READY_QUEUE_H
+
+// header files
+#include <stdlib.h>
+#include "StringUtils.h"
+#include "EventQueue.h"
+
+// global constants
+#define INIT_READY_CAPACITY 64
+#define MAX_READY_LEVELS 16
+
+// FIFO ring of queued entries, doubling its storage when full
+typedef struct ReadyRing
+   {
+    void **entries;
+    int head;
+    int count;
+    int capacity;
+   } ReadyRing;
+
+// processes waiting for the cpu; shortest-job modes keep a min-heap keyed
+// by time remaining, first-come modes keep one FIFO ring, and multilevel
+// modes keep one ring per priority level, with a mask bit set for each
+// level holding entries so the highest is found without a scan
+typedef struct ReadyQueue
+   {
+    Boolean heapOrder;
+    EventQueue heap;
+    ReadyRing *rings;
+    int numLevels;
+    unsigned int levelMask;
+   } ReadyQueue;
+
+// function prototypes
+void clearReadyQueue(ReadyQueue *queuePtr);
+void initReadyQueue(ReadyQueue *queuePtr, Boolean heapOrder, int numLevels);
+void *popReady(ReadyQueue *queuePtr);
+void *popRing(ReadyRing *ringPtr);
+void pushReady(ReadyQueue *queuePtr, void *dataPtr, double sortKey);
+void pushRing(ReadyRing *ringPtr, void *dataPtr);
+int raiseReadyLevels(ReadyQueue *queuePtr);
+int readyCount(ReadyQueue *queuePtr);
+int topReadyLevel(ReadyQueue *queuePtr);
+
+#endif // READY_QUEUE_H
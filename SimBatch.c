@@ -0,0 +1,426 @@
+// header files
+#include "SimBatch.h"
+
+// serializes the upstream config loader, which is not reentrant, across
+// batch workers
+static pthread_mutex_t configLoadLock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Function Name: clearBatch
+ * Algorithm: releases the entry array
+ * Precondition: given loaded batch
+ * Postcondition: batch emptied, memory returned to OS
+ * Exceptions: none
+ * Notes: none
+ */
+void clearBatch(SimBatch *batchPtr)
+   {
+    free(batchPtr->entries);
+    batchPtr->entries = NULL;
+    batchPtr->numEntries = 0;
+    batchPtr->capacity = 0;
+   }
+
+/*
+ * Function Name: loadBatchManifest
+ * Algorithm: reads manifest lines of the form
+ *               <config file> [<meta data file> | -] [<output file>]
+ *            skipping blank lines and lines starting with the comment
+ *            character, and adds one entry per line
+ * Precondition: given batch storage, manifest file name, and error
+ *               message storage
+ * Postcondition: batch filled in and True returned, or False returned with
+ *                error message set and batch left empty
+ * Exceptions: unreadable manifest, or a line that is too long or has too
+ *             many or overlong fields, is reported and rejected
+ * Notes: a "-" meta data field keeps the file named in the config
+ */
+Boolean loadBatchManifest(SimBatch *batchPtr, char *manifestName,
+                                                              char *errorMsg)
+   {
+    // initialize function/variables
+    char lineStr[ MAX_STR_LEN * 4 ];
+    char *fields[ 4 ];
+    char *savePtr;
+    int numFields, fieldIndex, lineNum = 0;
+    BatchEntry *entryPtr;
+    FILE *filePtr = fopen(manifestName, "r");
+
+    // set batch to empty
+    batchPtr->entries = NULL;
+    batchPtr->numEntries = 0;
+    batchPtr->capacity = 0;
+    batchPtr->numThreads = 0;
+    batchPtr->wallTime = 0.0;
+
+    // check for manifest not found
+    if (filePtr == NULL)
+       {
+        sprintf(errorMsg, "Unable to open manifest file: %s", manifestName);
+        return False;
+       }
+
+    // loop across manifest lines
+    while (fgets(lineStr, sizeof(lineStr), filePtr) != NULL)
+       {
+        lineNum++;
+
+        // check for line too long to read whole
+        if (strchr(lineStr, '\n') == NULL && feof(filePtr) == 0)
+           {
+            sprintf(errorMsg, "Manifest line %d: line too long", lineNum);
+            fclose(filePtr);
+            clearBatch(batchPtr);
+            return False;
+           }
+
+        // split line into whitespace separated fields
+        numFields = 0;
+        fields[ numFields ] = strtok_r(lineStr, " \t\r\n", &savePtr);
+        while (fields[ numFields ] != NULL && numFields < 3)
+           {
+            numFields++;
+            fields[ numFields ] = strtok_r(NULL, " \t\r\n", &savePtr);
+           }
+
+        // skip blank and comment lines
+        if (numFields == 0 || fields[ 0 ][ 0 ] == BATCH_COMMENT_CHAR)
+           {
+            continue;
+           }
+
+        // check for extra or overlong fields
+        if (numFields == 3 && fields[ 3 ] != NULL)
+           {
+            numFields = 4;
+           }
+        for (fieldIndex = 0; fieldIndex < numFields && fieldIndex < 3;
+                                                               fieldIndex++)
+           {
+            if (getStringLength(fields[ fieldIndex ]) >= LARGE_STR_LEN)
+               {
+                numFields = 4;
+               }
+           }
+        if (numFields > 3)
+           {
+            sprintf(errorMsg, "Manifest line %d: expected config file, "
+                          "optional meta data and output files", lineNum);
+            fclose(filePtr);
+            clearBatch(batchPtr);
+            return False;
+           }
+
+        // grow entry array, if full
+        if (batchPtr->numEntries == batchPtr->capacity)
+           {
+            batchPtr->capacity = batchPtr->capacity == 0
+                            ? INIT_BATCH_CAPACITY : batchPtr->capacity * 2;
+            batchPtr->entries = (BatchEntry*)realloc(batchPtr->entries,
+                                   sizeof(BatchEntry) * batchPtr->capacity);
+           }
+
+        // fill in entry
+        entryPtr = &batchPtr->entries[ batchPtr->numEntries ];
+        entryPtr->lineNum = lineNum;
+        copyString(entryPtr->configFileName, fields[ 0 ]);
+        entryPtr->metaDataFileName[ 0 ] = NULL_CHAR;
+        entryPtr->outputFileName[ 0 ] = NULL_CHAR;
+        if (numFields > 1
+             && compareString(fields[ 1 ], BATCH_DEFAULT_META) != STR_EQ)
+           {
+            copyString(entryPtr->metaDataFileName, fields[ 1 ]);
+           }
+        if (numFields > 2)
+           {
+            copyString(entryPtr->outputFileName, fields[ 2 ]);
+           }
+        batchPtr->numEntries++;
+       }
+
+    // close manifest and return success
+    fclose(filePtr);
+    return True;
+   }
+
+/*
+ * Function Name: runBatch
+ * Algorithm: hands every entry to a worker pool as an independent job,
+ *            then waits for them all
+ * Precondition: given loaded batch and number of concurrent simulations,
+ *               less than one for one per online processor
+ * Postcondition: every entry run and its outcome recorded, batch wall
+ *                time set
+ * Exceptions: none
+ * Notes: each simulation owns its clock, log, and monitor stream, and
+ *        its log, trace, and metrics files are named for its manifest
+ *        line, so no state is shared between jobs
+ */
+void runBatch(SimBatch *batchPtr, int numThreads)
+   {
+    // initialize function/variables
+    WorkerPool *pool;
+    struct timespec startTime;
+    int index;
+
+    // default to one simulation per processor
+    if (numThreads < 1)
+       {
+        numThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+       }
+    if (numThreads > batchPtr->numEntries)
+       {
+        numThreads = batchPtr->numEntries;
+       }
+    batchPtr->numThreads = numThreads;
+
+    // check for nothing to run
+    if (batchPtr->numEntries == 0)
+       {
+        return;
+       }
+
+    // submit every entry, then wait for each in turn
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    pool = createWorkerPool(numThreads);
+    for (index = 0; index < batchPtr->numEntries; index++)
+       {
+        submitJob(pool, &batchPtr->entries[ index ].job, &runBatchEntry,
+                                                &batchPtr->entries[ index ]);
+       }
+    for (index = 0; index < batchPtr->numEntries; index++)
+       {
+        waitForJob(pool, &batchPtr->entries[ index ].job);
+       }
+    destroyWorkerPool(pool);
+    batchPtr->wallTime = secondsSince(&startTime);
+   }
+
+/*
+ * Function Name: runBatchEntry
+ * Algorithm: worker pool job for one manifest entry; loads its config,
+ *            maps its meta data file straight into a program, or loads
+ *            the program's cache when the config enables one, suffixes
+ *            the config's output file names with the manifest line, runs
+ *            the simulation with the entry's own output file as monitor,
+ *            and records the outcome
+ * Precondition: given batch entry
+ * Postcondition: entry status, result, and wall time set, all loaded data
+ *                released
+ * Exceptions: unreadable config, meta data, or output file is recorded in
+ *             the entry status rather than displayed
+ * Notes: without an output file, monitor output is discarded; the
+ *        upstream config loader runs under a lock, while meta data is read
+ *        by the reentrant mapped and cached loaders
+ */
+void *runBatchEntry(void *entryPtr)
+   {
+    // initialize function/variables
+    BatchEntry *entry = entryPtr;
+    ConfigDataType *configPtr = NULL;
+    SimProgram program;
+    FILE *monitorPtr = NULL;
+    char errorMsg[ MAX_STR_LEN ];
+    struct timespec startTime;
+    Boolean loaded, fromCache = False;
+
+    // set entry to not yet run
+    clock_gettime(CLOCK_MONOTONIC, &startTime);
+    entry->schedCode = -1;
+    entry->result.completed = False;
+    entry->wallTime = 0.0;
+
+    // load config one worker at a time, overriding its meta data file if
+    // one was given
+    pthread_mutex_lock(&configLoadLock);
+    loaded = getConfigData(entry->configFileName, &configPtr, errorMsg);
+    pthread_mutex_unlock(&configLoadLock);
+    if (loaded == False)
+       {
+        copyString(entry->statusStr, "config error");
+        return NULL;
+       }
+    entry->schedCode = configPtr->cpuSchedCode;
+    if (getStringLength(entry->metaDataFileName) > 0)
+       {
+        copyString(configPtr->metaDataFileName, entry->metaDataFileName);
+       }
+
+    // keep entries sharing a config from writing the same files
+    suffixFileName(configPtr->logToFileName, entry->lineNum);
+    suffixFileName(configPtr->traceFileName, entry->lineNum);
+    suffixFileName(configPtr->metricsFileName, entry->lineNum);
+
+    // load program, through its cache if enabled
+    if (configPtr->programCache == True)
+       {
+        loaded = loadCachedProgram(&program, configPtr, &fromCache,
+                                                                   errorMsg);
+       }
+    else
+       {
+        loaded = mapProgramFile(&program, configPtr->metaDataFileName,
+                                                                   errorMsg);
+       }
+    if (loaded == False)
+       {
+        copyString(entry->statusStr, "meta data error");
+        clearConfigData(configPtr);
+        return NULL;
+       }
+
+    // open monitor output file, if any
+    if (getStringLength(entry->outputFileName) > 0)
+       {
+        monitorPtr = fopen(entry->outputFileName, "w");
+        if (monitorPtr == NULL)
+           {
+            copyString(entry->statusStr, "output error");
+            clearProgram(&program);
+            clearConfigData(configPtr);
+            return NULL;
+           }
+       }
+
+    // run simulation, releasing program
+    runProgram(configPtr, &program, monitorPtr, &entry->result);
+    copyString(entry->statusStr, fromCache == True ? "ok (cached)" : "ok");
+    entry->wallTime = secondsSince(&startTime);
+
+    // release output file and config
+    if (monitorPtr != NULL)
+       {
+        fclose(monitorPtr);
+       }
+    clearConfigData(configPtr);
+    return NULL;
+   }
+
+/*
+ * Function Name: secondsSince
+ * Algorithm: finds monotonic time passed since the given start time
+ * Precondition: given start time taken from the monotonic clock
+ * Postcondition: elapsed seconds returned
+ * Exceptions: none
+ * Notes: none
+ */
+double secondsSince(struct timespec *startPtr)
+   {
+    // initialize function/variables
+    struct timespec nowTime;
+
+    // find time since start
+    clock_gettime(CLOCK_MONOTONIC, &nowTime);
+    return (double)(nowTime.tv_sec - startPtr->tv_sec)
+                   + (double)(nowTime.tv_nsec - startPtr->tv_nsec)
+                                                              / NANO_PER_SEC;
+   }
+
+/*
+ * Function Name: suffixFileName
+ * Algorithm: inserts a dot and the manifest line number before the file
+ *            name's extension, or appends them when it has none
+ * Precondition: given file name, possibly empty, and manifest line number
+ * Postcondition: non-empty file name suffixed, e.g. sim.lgf on line 3
+ *                becoming sim.3.lgf
+ * Exceptions: none
+ * Notes: only a dot past the start of the last path component starts an
+ *        extension
+ */
+void suffixFileName(char *fileName, int lineNum)
+   {
+    // initialize function/variables
+    char suffixedName[ LARGE_STR_LEN ];
+    char *basePtr = strrchr(fileName, '/');
+    char *dotPtr = strrchr(fileName, '.');
+
+    // check for no file named
+    if (getStringLength(fileName) == 0)
+       {
+        return;
+       }
+
+    // insert line number before extension, or append it without one
+    basePtr = basePtr == NULL ? fileName : basePtr + 1;
+    if (dotPtr == NULL || dotPtr <= basePtr)
+       {
+        snprintf(suffixedName, LARGE_STR_LEN, "%s.%d", fileName, lineNum);
+       }
+    else
+       {
+        snprintf(suffixedName, LARGE_STR_LEN, "%.*s.%d%s",
+                     (int)(dotPtr - fileName), fileName, lineNum, dotPtr);
+       }
+    copyString(fileName, suffixedName);
+   }
+
+/*
+ * Function Name: writeBatchSummary
+ * Algorithm: writes one table row per entry in manifest order, followed by
+ *            batch totals
+ * Precondition: given run batch and output stream
+ * Postcondition: summary table written
+ * Exceptions: none
+ * Notes: columns of entries that did not run are shown as "-"
+ */
+void writeBatchSummary(SimBatch *batchPtr, FILE *outPtr)
+   {
+    // initialize function/variables
+    BatchEntry *entry;
+    char schedStr[ STD_STR_LEN ];
+    int index, numCompleted = 0;
+    double totalSimWall = 0.0;
+
+    // display table heading
+    fprintf(outPtr, "Simulator Batch Summary\n");
+    fprintf(outPtr, "=======================\n\n");
+    fprintf(outPtr, "%4s  %-28s %-7s %6s %8s %5s %12s %10s %10s %6s "
+                "%10s  %s\n", "Line", "Config", "Sched", "Procs", "Ops",
+                "Cores", "Sim Time", "Avg Turn", "Avg Wait", "CPU %",
+                                                    "Wall (ms)", "Status");
+
+    // loop across entries
+    for (index = 0; index < batchPtr->numEntries; index++)
+       {
+        entry = &batchPtr->entries[ index ];
+        fprintf(outPtr, "%4d  %-28s ", entry->lineNum,
+                                                     entry->configFileName);
+
+        // display scheduler, if config was loaded
+        if (entry->schedCode >= 0)
+           {
+            configCodeToString(entry->schedCode, schedStr);
+            fprintf(outPtr, "%-7s ", schedStr);
+           }
+        else
+           {
+            fprintf(outPtr, "%-7s ", "-");
+           }
+
+        // display run totals, if run completed
+        if (entry->result.completed == True)
+           {
+            fprintf(outPtr, "%6d %8d %5d %12.6f %10.6f %10.6f %6.1f "
+                     "%10.1f  %s\n", entry->result.numProcs,
+                     entry->result.numOps, entry->result.numCores,
+                     entry->result.simTime,
+                     entry->result.metrics.avgTurnaround,
+                     entry->result.metrics.avgWaiting,
+                     entry->result.metrics.cpuUtilization * PERCENT,
+                           entry->wallTime * MS_PER_SEC, entry->statusStr);
+            numCompleted++;
+            totalSimWall += entry->wallTime;
+           }
+        else
+           {
+            fprintf(outPtr, "%6s %8s %5s %12s %10s %10s %6s %10s  %s\n",
+                     "-", "-", "-", "-", "-", "-", "-", "-", entry->statusStr);
+           }
+       }
+
+    // display batch totals
+    fprintf(outPtr, "\n%d of %d simulations completed on %d threads\n",
+                   numCompleted, batchPtr->numEntries, batchPtr->numThreads);
+    fprintf(outPtr, "Batch wall time: %.1f ms (%.1f ms of simulation)\n",
+                batchPtr->wallTime * MS_PER_SEC, totalSimWall * MS_PER_SEC);
+   }
@@ -0,0 +1,57 @@
+// Preprocessor directive
+#ifndef SIM_BATCH_H
+#define SIM_BATCH_H
+
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "SimContext.h"
+#include "MetaLoader.h"
+#include "ProgramCache.h"
+
+// global constants
+#define INIT_BATCH_CAPACITY 16
+#define BATCH_COMMENT_CHAR '#'
+#define BATCH_DEFAULT_META "-"
+#define NANO_PER_SEC 1.0e9
+
+// one manifest line; a config file, an optional meta data file replacing
+// the one the config names, and an optional file capturing the run's
+// monitor output, plus the outcome once run
+typedef struct BatchEntry
+   {
+    WorkerJob job;
+    int lineNum;
+    char configFileName[ LARGE_STR_LEN ];
+    char metaDataFileName[ LARGE_STR_LEN ];
+    char outputFileName[ LARGE_STR_LEN ];
+    int schedCode;
+    SimResult result;
+    double wallTime;
+    char statusStr[ STD_STR_LEN ];
+   } BatchEntry;
+
+// every simulation named in a manifest, run independently on a pool
+typedef struct SimBatch
+   {
+    BatchEntry *entries;
+    int numEntries;
+    int capacity;
+    int numThreads;
+    double wallTime;
+   } SimBatch;
+
+// function prototypes
+void clearBatch(SimBatch *batchPtr);
+Boolean loadBatchManifest(SimBatch *batchPtr, char *manifestName,
+                                                             char *errorMsg);
+void runBatch(SimBatch *batchPtr, int numThreads);
+void *runBatchEntry(void *entryPtr);
+double secondsSince(struct timespec *startPtr);
+void suffixFileName(char *fileName, int lineNum);
+void writeBatchSummary(SimBatch *batchPtr, FILE *outPtr);
+
+#endif // SIM_BATCH_H
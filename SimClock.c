@@ -0,0 +1,145 @@
+// header files
+#include "SimClock.h"
+
+/*
+ * Function Name: accessClock
+ * Algorithm: zeroes the clock if requested, then reads it and formats the
+ *            time in the simtimer string format
+ * Precondition: given clock, timer control code, and time string storage
+ * Postcondition: time string set, elapsed seconds returned
+ * Exceptions: none
+ * Notes: STOP_TIMER behaves as LAP_TIMER
+ */
+double accessClock(SimClock *clockPtr, int controlCode, char *timeStr)
+   {
+    // initialize function/variables
+    double elapsedTime;
+
+    // check for zero timer request, taking now as the zero point
+    if (controlCode == ZERO_TIMER)
+       {
+        gettimeofday(&clockPtr->startTime, NULL);
+        clockPtr->currentTime = 0.0;
+        elapsedTime = 0.0;
+       }
+
+    // otherwise, read clock
+    else
+       {
+        elapsedTime = readClock(clockPtr);
+       }
+
+    // format time and return it
+    sprintf(timeStr, VIRTUAL_TIME_FORMAT, elapsedTime);
+    return elapsedTime;
+   }
+
+/*
+ * Function Name: advanceClock
+ * Algorithm: moves virtual time forward by the given op duration
+ * Precondition: given clock in virtual mode and duration in ms
+ * Postcondition: virtual time advanced, nothing sleeps
+ * Exceptions: none
+ * Notes: no effect in real mode; virtual time stays on whole ms
+ */
+void advanceClock(SimClock *clockPtr, int milliSeconds)
+   {
+    // check for virtual mode
+    if (clockPtr->virtualMode == True)
+       {
+        clockPtr->currentTime = timeAfter(clockPtr->currentTime,
+                                                               milliSeconds);
+       }
+   }
+
+/*
+ * Function Name: advanceClockTo
+ * Algorithm: jumps virtual time to the given event time if it is later
+ * Precondition: given clock in virtual mode and event time in seconds
+ * Postcondition: virtual time is at least the given time
+ * Exceptions: none
+ * Notes: no effect in real mode; time never runs backwards
+ */
+void advanceClockTo(SimClock *clockPtr, double newTime)
+   {
+    // check for virtual mode and later time
+    if (clockPtr->virtualMode == True && newTime > clockPtr->currentTime)
+       {
+        clockPtr->currentTime = newTime;
+       }
+   }
+
+/*
+ * Function Name: initSimClock
+ * Algorithm: sets clock mode, zeroes virtual time, and takes now as the
+ *            real time zero point
+ * Precondition: given clock storage and mode flag
+ * Postcondition: clock ready for use
+ * Exceptions: none
+ * Notes: none
+ */
+void initSimClock(SimClock *clockPtr, Boolean virtualMode)
+   {
+    clockPtr->virtualMode = virtualMode;
+    clockPtr->currentTime = 0.0;
+    gettimeofday(&clockPtr->startTime, NULL);
+   }
+
+/*
+ * Function Name: readClock
+ * Algorithm: real mode measures time since the clock's own zero point;
+ *            virtual mode reports the virtual time
+ * Precondition: given initialized clock
+ * Postcondition: elapsed seconds returned
+ * Exceptions: none
+ * Notes: used for timestamps that are not displayed, so no string is
+ *        formatted
+ */
+double readClock(SimClock *clockPtr)
+   {
+    // check for real time mode
+    if (clockPtr->virtualMode == False)
+       {
+        clockPtr->currentTime = readRealClock(clockPtr);
+       }
+
+    // return current time
+    return clockPtr->currentTime;
+   }
+
+/*
+ * Function Name: readRealClock
+ * Algorithm: measures wall time since the clock's own zero point
+ * Precondition: given initialized clock
+ * Postcondition: elapsed seconds returned, clock left unchanged
+ * Exceptions: none
+ * Notes: safe to call from threads other than the dispatcher, as it
+ *        stores nothing
+ */
+double readRealClock(SimClock *clockPtr)
+   {
+    // initialize function/variables
+    struct timeval nowTime;
+
+    // find elapsed time since zero point
+    gettimeofday(&nowTime, NULL);
+    return (double)(nowTime.tv_sec - clockPtr->startTime.tv_sec)
+             + (double)(nowTime.tv_usec - clockPtr->startTime.tv_usec)
+                                                                    / 1.0e6;
+   }
+
+/*
+ * Function Name: timeAfter
+ * Algorithm: counts the given time in whole ms, adds the given ms, and
+ *            converts back to seconds
+ * Precondition: given time in seconds, not negative, and ms to add
+ * Postcondition: later time returned, on a whole ms
+ * Exceptions: none
+ * Notes: virtual times are all built this way, so times reached by
+ *        different sums of ms compare equal rather than drifting apart
+ *        by rounding
+ */
+double timeAfter(double fromTime, int milliSeconds)
+   {
+    return ((long)(fromTime * MS_PER_SEC + 0.5) + milliSeconds) / MS_PER_SEC;
+   }
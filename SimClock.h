@@ -0,0 +1,35 @@
+// Preprocessor directive
+#ifndef SIM_CLOCK_H
+#define SIM_CLOCK_H
+
+// header files
+#include <stdio.h>
+#include <sys/time.h>
+#include "StringUtils.h"
+#include "simtimer.h"
+
+// global constants
+#define MS_PER_SEC 1000.0
+#define VIRTUAL_TIME_FORMAT "%9.6f"
+
+// simulator clock; real mode measures wall time from its own start time,
+// so simulations running side by side do not share simtimer's state;
+// virtual mode keeps its own time that only moves when the simulator
+// advances it
+typedef struct SimClock
+   {
+    Boolean virtualMode;
+    double currentTime;
+    struct timeval startTime;
+   } SimClock;
+
+// function prototypes
+double accessClock(SimClock *clockPtr, int controlCode, char *timeStr);
+void advanceClock(SimClock *clockPtr, int milliSeconds);
+void advanceClockTo(SimClock *clockPtr, double newTime);
+void initSimClock(SimClock *clockPtr, Boolean virtualMode);
+double readClock(SimClock *clockPtr);
+double readRealClock(SimClock *clockPtr);
+double timeAfter(double fromTime, int milliSeconds);
+
+#endif // SIM_CLOCK_H
@@ -0,0 +1,103 @@
+// Preprocessor directive
+#ifndef SIM_CONTEXT_H
+#define SIM_CONTEXT_H
+
+// header files
+#include <limits.h>
+#include <pthread.h>
+#include "Simulator.h"
+#include "WorkerPool.h"
+#include "Interrupts.h"
+#include "DeviceSet.h"
+#include "SimClock.h"
+#include "SimLog.h"
+#include "ReadyQueue.h"
+#include "CoreSet.h"
+#include "OpDecode.h"
+#include "SimProgram.h"
+#include "MemoryMgr.h"
+#include "Paging.h"
+#include "SimMetrics.h"
+#include "SimProfile.h"
+
+// global constants
+#define INITIAL_BURST_CYCLES 10
+#define MLFQ_DEFAULT_LEVELS 3
+#define MLFQ_DEFAULT_SCALE 2
+
+// state of one simulation run, shared by all of its cores; simLock guards
+// everything here except the interrupt queue, which has its own lock, and
+// is released only while a core waits on a timed cpu op or for work; the
+// level fields hold the multilevel feedback queue's per-level quanta and
+// aging state, where each aging pass starts a new epoch so processes not
+// queued when it runs are raised the next time they are scheduled; in
+// device mode each device has its own request queue and service worker;
+// cpu ops run on their own pool, one worker per core, so they never wait
+// behind I/O jobs blocking the op pool's workers
+typedef struct SimContext
+   {
+    ConfigDataType *configPtr;
+    SimProgram program;
+    PCB *pcbArray;
+    SimClock simClock;
+    SimLog simLog;
+    MemoryMgr memory;
+    PagingMgr pager;
+    Boolean pagedMode;
+    Boolean preemptive;
+    Boolean levelMode;
+    int numLevels;
+    int levelQuanta[ MAX_READY_LEVELS ];
+    long agingEpoch;
+    double nextAgingTime;
+    WorkerPool *opPool;
+    WorkerPool *cpuPool;
+    InterruptQueue interrupts;
+    Boolean deviceMode;
+    DeviceSet devices;
+    CoreSet cores;
+    pthread_mutex_t simLock;
+   } SimContext;
+
+// totals of one finished simulation, for callers running many
+typedef struct SimResult
+   {
+    Boolean completed;
+    int numProcs;
+    int numOps;
+    int numCores;
+    double simTime;
+    SimMetrics metrics;
+   } SimResult;
+
+// one simulated cpu running the dispatch loop on its own thread
+typedef struct SimCore
+   {
+    int coreId;
+    pthread_t coreThread;
+    SimContext *simPtr;
+   } SimCore;
+
+// function prototypes
+void admitProcess(PCB *pcbPtr, SimContext *simPtr, int coreId);
+void ageLevels(SimContext *simPtr);
+void endCpuBurst(PCB *pcbPtr, SimContext *simPtr);
+PCB *getNextProcess(PCB *localPtr, PCB *preemptedPtr, SimContext *simPtr,
+                                                                 int coreId);
+void handleInterrupt(IoRequest *requestPtr, SimContext *simPtr, int coreId);
+Boolean hasWorkLeft(PCB *pcbPtr, SimContext *simPtr);
+void refreshLevel(PCB *pcbPtr, SimContext *simPtr);
+void *runCore(void *corePtr);
+void runProcessOp(PCB *pcbPtr, Boolean dispatched, SimContext *simPtr,
+                                                                 int coreId);
+Boolean runProgram(ConfigDataType *configPtr, SimProgram *programPtr,
+                                     FILE *monitorPtr, SimResult *resultPtr);
+Boolean runSimulation(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr,
+                                     FILE *monitorPtr, SimResult *resultPtr);
+void setLevel(PCB *pcbPtr, SimContext *simPtr, int level);
+void setLevelQuanta(SimContext *simPtr);
+void setReady(PCB *pcbPtr, SimContext *simPtr, int coreId);
+Boolean simComplete(CoreSet *coreSetPtr);
+Boolean usesBurstPrediction(ConfigDataType *configPtr);
+
+#endif // SIM_CONTEXT_H
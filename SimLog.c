@@ -0,0 +1,215 @@
+// header files
+#include "SimLog.h"
+
+/*
+ * Function Name: closeSimLog
+ * Algorithm: stops the text and trace writers, which write everything
+ *            still queued, and closes their files
+ * Precondition: given opened log and config data
+ * Postcondition: all output written, user notified of any failure on the
+ *                monitor, if any
+ * Exceptions: none
+ * Notes: none
+ */
+void closeSimLog(SimLog *logPtr, ConfigDataType *configPtr)
+   {
+    // close text log file
+    if (closeLogBuffer(&logPtr->textLog) == False
+                                             && logPtr->monitorPtr != NULL)
+       {
+        fprintf(logPtr->monitorPtr, "Unable to write log file: %s\n",
+                                                  configPtr->logToFileName);
+       }
+
+    // close trace file
+    if (closeLogBuffer(&logPtr->traceLog) == False
+                                             && logPtr->monitorPtr != NULL)
+       {
+        fprintf(logPtr->monitorPtr, "Unable to write trace file: %s\n",
+                                                  configPtr->traceFileName);
+       }
+   }
+
+/*
+ * Function Name: findTraceDevice
+ * Algorithm: looks up a device name in the trace device table; a name not
+ *            yet seen is added and announced with an EVT_DEVICE_NAME record
+ * Precondition: given log with trace open and device name
+ * Postcondition: device id returned, TRACE_NO_DEVICE if table is full
+ * Exceptions: none
+ * Notes: device counts are small, so a linear search is used
+ */
+int findTraceDevice(SimLog *logPtr, char *deviceName)
+   {
+    // initialize function/variables
+    TraceRecord record;
+    int index;
+
+    // search existing names
+    for (index = 0; index < logPtr->numDevices; index++)
+       {
+        if (compareString(logPtr->deviceNames[ index ], deviceName) == STR_EQ)
+           {
+            return index;
+           }
+       }
+
+    // check for full table
+    if (logPtr->numDevices == MAX_TRACE_DEVICES)
+       {
+        return TRACE_NO_DEVICE;
+       }
+
+    // add name and define it in the trace
+    copyString(logPtr->deviceNames[ index ], deviceName);
+    logPtr->numDevices++;
+
+    record.eventTime = 0.0;
+    record.pid = 0;
+    record.eventCode = EVT_DEVICE_NAME;
+    record.deviceId = (short)index;
+    record.eventArg = getStringLength(deviceName);
+    appendLogBytes(&logPtr->traceLog, &record, sizeof(TraceRecord));
+    appendLogBytes(&logPtr->traceLog, deviceName, (size_t)record.eventArg);
+
+    // return new id
+    return index;
+   }
+
+/*
+ * Function Name: logEvent
+ * Algorithm: stamps an event with the simulator clock, then formats it for
+ *            the monitor and text log and/or appends a binary record to
+ *            the trace, as configured
+ * Precondition: given opened log, event code, pid, device name for I/O
+ *               events (otherwise NULL), and event argument
+ * Postcondition: event output to each configured sink
+ * Exceptions: none
+ * Notes: the clock is read without formatting, and the time and text are
+ *        only formatted when some sink displays them
+ */
+void logEvent(SimLog *logPtr, int eventCode, int pid,
+                                            char *deviceName, int64_t eventArg)
+   {
+    // initialize function/variables
+    char timeStr[STD_STR_LEN];
+    char statusMessage[MAX_EVENT_LINE_LEN];
+    TraceRecord record;
+    Boolean toMonitor = logPtr->monitorPtr != NULL
+                         && (logPtr->logToCode == LOGTO_MONITOR_CODE
+                                  || logPtr->logToCode == LOGTO_BOTH_CODE);
+
+    // stamp event
+    PROFILE_BEGIN(PROF_LOG_EVENT);
+    record.eventTime = readClock(logPtr->clockPtr);
+
+    // format and display text, if configured
+    if (toMonitor == True || logPtr->textLog.writerRunning == True)
+       {
+        PROFILE_BEGIN(PROF_LOG_FORMAT);
+        sprintf(timeStr, VIRTUAL_TIME_FORMAT, record.eventTime);
+        formatEvent(statusMessage, timeStr, eventCode, pid,
+                                                      deviceName, eventArg);
+        PROFILE_END(PROF_LOG_FORMAT);
+        if (toMonitor == True)
+           {
+            fputs(statusMessage, logPtr->monitorPtr);
+           }
+        appendLog(&logPtr->textLog, statusMessage);
+       }
+
+    // append binary record, if tracing
+    if (logPtr->traceLog.writerRunning == True)
+       {
+        record.pid = pid;
+        record.eventCode = (short)eventCode;
+        record.deviceId = TRACE_NO_DEVICE;
+        if (deviceName != NULL)
+           {
+            record.deviceId = (short)findTraceDevice(logPtr, deviceName);
+           }
+        record.eventArg = eventArg;
+        appendLogBytes(&logPtr->traceLog, &record, sizeof(TraceRecord));
+       }
+    PROFILE_END(PROF_LOG_EVENT);
+   }
+
+/*
+ * Function Name: logText
+ * Algorithm: displays preformatted text on the monitor and appends it to
+ *            the text log, as configured, without a timestamp
+ * Precondition: given opened log and text
+ * Postcondition: text output to each configured text sink
+ * Exceptions: none
+ * Notes: used for reports written after the event log; not traced
+ */
+void logText(SimLog *logPtr, char *outputStr)
+   {
+    // display text, if configured
+    if (logPtr->monitorPtr != NULL
+                         && (logPtr->logToCode == LOGTO_MONITOR_CODE
+                                  || logPtr->logToCode == LOGTO_BOTH_CODE))
+       {
+        fputs(outputStr, logPtr->monitorPtr);
+       }
+
+    // append to text log, if open
+    if (logPtr->textLog.writerRunning == True)
+       {
+        appendLog(&logPtr->textLog, outputStr);
+       }
+   }
+
+/*
+ * Function Name: openSimLog
+ * Algorithm: starts the configured file writers; a named trace file takes
+ *            the place of the text log file, which can be rendered from
+ *            the trace offline
+ * Precondition: given log storage, config data, simulator clock, and
+ *               monitor stream, NULL for none
+ * Postcondition: log ready for events, user notified of any open failure
+ *                on the monitor, if any
+ * Exceptions: none
+ * Notes: monitor output is unaffected by tracing
+ */
+void openSimLog(SimLog *logPtr, ConfigDataType *configPtr,
+                                      SimClock *clockPtr, FILE *monitorPtr)
+   {
+    // initialize log data
+    int version = TRACE_VERSION;
+    logPtr->logToCode = configPtr->logToCode;
+    logPtr->monitorPtr = monitorPtr;
+    logPtr->clockPtr = clockPtr;
+    logPtr->numDevices = 0;
+    initLogBuffer(&logPtr->textLog);
+    initLogBuffer(&logPtr->traceLog);
+
+    // check for binary trace requested
+    if (getStringLength(configPtr->traceFileName) > 0)
+       {
+        if (openLogBuffer(&logPtr->traceLog, configPtr->traceFileName,
+                                         configPtr->logFlushSize) == False
+                                                     && monitorPtr != NULL)
+           {
+            fprintf(monitorPtr, "Unable to open trace file: %s\n",
+                                                  configPtr->traceFileName);
+           }
+
+        // write trace header
+        appendLogBytes(&logPtr->traceLog, TRACE_MAGIC, TRACE_MAGIC_LEN);
+        appendLogBytes(&logPtr->traceLog, &version, sizeof(int));
+       }
+
+    // otherwise, check for text log file requested
+    else if (configPtr->logToCode == LOGTO_FILE_CODE
+                                || configPtr->logToCode == LOGTO_BOTH_CODE)
+       {
+        if (openLogBuffer(&logPtr->textLog, configPtr->logToFileName,
+                                         configPtr->logFlushSize) == False
+                                                     && monitorPtr != NULL)
+           {
+            fprintf(monitorPtr, "Unable to open log file: %s\n",
+                                                  configPtr->logToFileName);
+           }
+       }
+   }
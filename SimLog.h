@@ -0,0 +1,40 @@
+// Preprocessor directive
+#ifndef SIM_LOG_H
+#define SIM_LOG_H
+
+// header files
+#include <stdio.h>
+#include "StringUtils.h"
+#include "configops.h"
+#include "SimClock.h"
+#include "LogBuffer.h"
+#include "TraceEvents.h"
+#include "SimProfile.h"
+
+// global constants
+#define MAX_TRACE_DEVICES 256
+
+// simulator output sinks; text goes to the monitor and/or log file as
+// configured, binary records go to the trace file when one is named; the
+// monitor is a stream of the caller's choosing, NULL to display nothing
+typedef struct SimLog
+   {
+    int logToCode;
+    FILE *monitorPtr;
+    SimClock *clockPtr;
+    LogBuffer textLog;
+    LogBuffer traceLog;
+    int numDevices;
+    char deviceNames[ MAX_TRACE_DEVICES ][ STD_STR_LEN ];
+   } SimLog;
+
+// function prototypes
+void closeSimLog(SimLog *logPtr, ConfigDataType *configPtr);
+int findTraceDevice(SimLog *logPtr, char *deviceName);
+void logEvent(SimLog *logPtr, int eventCode, int pid,
+                                           char *deviceName, int64_t eventArg);
+void logText(SimLog *logPtr, char *outputStr);
+void openSimLog(SimLog *logPtr, ConfigDataType *configPtr,
+                                     SimClock *clockPtr, FILE *monitorPtr);
+
+#endif // SIM_LOG_H
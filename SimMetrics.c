@@ -0,0 +1,307 @@
+// header files
+#include "SimMetrics.h"
+
+// placement policy names, in MemFitCode order
+static const char *fitNames[] =
+   {
+    "None",
+    "First fit",
+    "Best fit",
+    "Worst fit"
+   };
+
+/*
+ * Function Name: computeMetrics
+ * Algorithm: derives each process's turnaround (completion less arrival),
+ *            waiting (time spent ready), and response (first run less
+ *            arrival) from its PCB timestamps, then totals them along with
+ *            cpu busy time; utilization is busy time over the makespan of
+ *            every core, throughput is processes per second of makespan,
+ *            and arrival rate is processes per second between the first
+ *            and last arrivals
+ * Precondition: given metrics storage and PCBs of a finished run
+ * Postcondition: metrics filled in
+ * Exceptions: none
+ * Notes: makespan runs from first arrival to last completion
+ */
+void computeMetrics(SimMetrics *metricsPtr, PCB *pcbArray, int numProcs,
+                                                                int numCores)
+   {
+    // initialize function/variables
+    double firstArrival = 0.0, lastArrival = 0.0, lastCompletion = 0.0;
+    double turnaround, response;
+    PCB *pcbPtr;
+    int index;
+
+    // set totals to zero
+    metricsPtr->numProcs = numProcs;
+    metricsPtr->numCores = numCores;
+    metricsPtr->cpuBusyTime = 0.0;
+    metricsPtr->avgTurnaround = 0.0;
+    metricsPtr->avgWaiting = 0.0;
+    metricsPtr->avgResponse = 0.0;
+    metricsPtr->avgIoWait = 0.0;
+    metricsPtr->maxTurnaround = 0.0;
+    metricsPtr->maxWaiting = 0.0;
+    metricsPtr->maxResponse = 0.0;
+
+    // loop across processes
+    for (index = 0; index < numProcs; index++)
+       {
+        pcbPtr = &pcbArray[ index ];
+        turnaround = pcbPtr->completionTime - pcbPtr->arrivalTime;
+        response = pcbPtr->firstRunTime - pcbPtr->arrivalTime;
+
+        // track run span
+        if (index == 0 || pcbPtr->arrivalTime < firstArrival)
+           {
+            firstArrival = pcbPtr->arrivalTime;
+           }
+        if (pcbPtr->arrivalTime > lastArrival)
+           {
+            lastArrival = pcbPtr->arrivalTime;
+           }
+        if (pcbPtr->completionTime > lastCompletion)
+           {
+            lastCompletion = pcbPtr->completionTime;
+           }
+
+        // add to totals and maximums
+        metricsPtr->cpuBusyTime += pcbPtr->cpuTime;
+        metricsPtr->avgTurnaround += turnaround;
+        metricsPtr->avgWaiting += pcbPtr->readyWaitTime;
+        metricsPtr->avgResponse += response;
+        metricsPtr->avgIoWait += pcbPtr->ioWaitTime;
+        if (turnaround > metricsPtr->maxTurnaround)
+           {
+            metricsPtr->maxTurnaround = turnaround;
+           }
+        if (pcbPtr->readyWaitTime > metricsPtr->maxWaiting)
+           {
+            metricsPtr->maxWaiting = pcbPtr->readyWaitTime;
+           }
+        if (response > metricsPtr->maxResponse)
+           {
+            metricsPtr->maxResponse = response;
+           }
+       }
+
+    // turn totals into averages
+    if (numProcs > 0)
+       {
+        metricsPtr->avgTurnaround /= numProcs;
+        metricsPtr->avgWaiting /= numProcs;
+        metricsPtr->avgResponse /= numProcs;
+        metricsPtr->avgIoWait /= numProcs;
+       }
+
+    // find system rates over makespan
+    metricsPtr->makespan = lastCompletion - firstArrival;
+    metricsPtr->cpuUtilization = 0.0;
+    metricsPtr->throughput = 0.0;
+    if (metricsPtr->makespan > 0.0)
+       {
+        metricsPtr->cpuUtilization = metricsPtr->cpuBusyTime
+                                      / (metricsPtr->makespan * numCores);
+        metricsPtr->throughput = numProcs / metricsPtr->makespan;
+       }
+
+    // find arrival rate over arrival span, counting gaps between arrivals
+    metricsPtr->arrivalRate = 0.0;
+    if (lastArrival > firstArrival)
+       {
+        metricsPtr->arrivalRate = (numProcs - 1)
+                                          / (lastArrival - firstArrival);
+       }
+   }
+
+/*
+ * Function Name: logMemoryReport
+ * Algorithm: writes the placement policy in use, the memory available and
+ *            the peak in use, segments placed and allocations failed for
+ *            lack of memory and for fragmentation, compactions, and the
+ *            average and peak external fragmentation, through the
+ *            simulator log's text sinks
+ * Precondition: given opened log, memory manager with a placement policy
+ *               after the run, and the run's end time in seconds
+ * Postcondition: report displayed and/or logged as configured
+ * Exceptions: none
+ * Notes: average fragmentation holds the last value to the end time
+ */
+void logMemoryReport(SimLog *logPtr, MemoryMgr *mgrPtr, double endTime)
+   {
+    // initialize function/variables
+    char lineStr[ MAX_EVENT_LINE_LEN ];
+    double fragArea = mgrPtr->fragArea, avgFragmentation = 0.0;
+
+    // find average fragmentation to end of run
+    if (endTime > mgrPtr->fragTime)
+       {
+        fragArea += mgrPtr->fragmentation * (endTime - mgrPtr->fragTime);
+       }
+    if (endTime > 0.0)
+       {
+        avgFragmentation = fragArea / endTime;
+       }
+
+    // display heading and policy
+    logText(logPtr, "\nEnd of Run Memory Placement (bytes)\n");
+    logText(logPtr, "-----------------------------------\n");
+    sprintf(lineStr, "Placement: %s, compaction %s\n",
+                   fitNames[ mgrPtr->fitCode ],
+                                  mgrPtr->compaction == True ? "on" : "off");
+    logText(logPtr, lineStr);
+
+    // display memory needed and allocation outcomes
+    sprintf(lineStr, "Memory: %d available, peak %d in use (%.2f%%)\n",
+             mgrPtr->memAvailable, mgrPtr->peakUsed,
+             mgrPtr->memAvailable > 0
+               ? (double)mgrPtr->peakUsed / mgrPtr->memAvailable * PERCENT
+                                                                     : 0.0);
+    logText(logPtr, lineStr);
+    sprintf(lineStr, "Segments placed: %ld, failed for lack of memory: %ld, "
+                          "failed for fragmentation: %ld\n",
+                             mgrPtr->numPlaced, mgrPtr->sizeFailures,
+                                                        mgrPtr->fitFailures);
+    logText(logPtr, lineStr);
+    sprintf(lineStr, "Compactions: %ld, moving %ld bytes\n",
+                                 mgrPtr->compactions, mgrPtr->bytesMoved);
+    logText(logPtr, lineStr);
+
+    // display fragmentation over run
+    sprintf(lineStr, "External fragmentation: average %.2f%%, peak %.2f%%, "
+                        "%d free hole(s) at end\n",
+                        avgFragmentation * PERCENT,
+                        mgrPtr->maxFragmentation * PERCENT, mgrPtr->numHoles);
+    logText(logPtr, lineStr);
+   }
+
+/*
+ * Function Name: logMetricsReport
+ * Algorithm: writes a table of each process's timestamps and derived
+ *            times, followed by the averages, maximums, and system rates,
+ *            through the simulator log's text sinks
+ * Precondition: given opened log, computed metrics, and PCBs of the run
+ * Postcondition: report displayed and/or logged as configured
+ * Exceptions: none
+ * Notes: all times in seconds
+ */
+void logMetricsReport(SimLog *logPtr, SimMetrics *metricsPtr,
+                                                PCB *pcbArray, int numProcs)
+   {
+    // initialize function/variables
+    char lineStr[ MAX_EVENT_LINE_LEN ];
+    PCB *pcbPtr;
+    int index;
+
+    // display heading
+    logText(logPtr, "\nEnd of Run Metrics (seconds)\n");
+    logText(logPtr, "----------------------------\n");
+    sprintf(lineStr, "%6s %10s %10s %10s %10s %10s %10s %10s %10s\n",
+                   "PID", "Arrival", "First Run", "Completion", "Turnaround",
+                              "Waiting", "Response", "CPU Time", "I/O Wait");
+    logText(logPtr, lineStr);
+
+    // display one row per process
+    for (index = 0; index < numProcs; index++)
+       {
+        pcbPtr = &pcbArray[ index ];
+        sprintf(lineStr,
+            "%6d %10.6f %10.6f %10.6f %10.6f %10.6f %10.6f %10.6f %10.6f\n",
+                pcbPtr->pid, pcbPtr->arrivalTime, pcbPtr->firstRunTime,
+                pcbPtr->completionTime,
+                pcbPtr->completionTime - pcbPtr->arrivalTime,
+                pcbPtr->readyWaitTime,
+                pcbPtr->firstRunTime - pcbPtr->arrivalTime,
+                                     pcbPtr->cpuTime, pcbPtr->ioWaitTime);
+        logText(logPtr, lineStr);
+       }
+
+    // display averages and maximums
+    sprintf(lineStr, "\n%6s %43.6f %10.6f %10.6f %21.6f\n", "Avg",
+                    metricsPtr->avgTurnaround, metricsPtr->avgWaiting,
+                          metricsPtr->avgResponse, metricsPtr->avgIoWait);
+    logText(logPtr, lineStr);
+    sprintf(lineStr, "%6s %43.6f %10.6f %10.6f\n", "Max",
+                    metricsPtr->maxTurnaround, metricsPtr->maxWaiting,
+                                                  metricsPtr->maxResponse);
+    logText(logPtr, lineStr);
+
+    // display system rates
+    sprintf(lineStr, "\nCPU utilization: %.2f%% of %d core(s), "
+                    "busy %.6f of %.6f makespan\n",
+                    metricsPtr->cpuUtilization * PERCENT, metricsPtr->numCores,
+                           metricsPtr->cpuBusyTime, metricsPtr->makespan);
+    logText(logPtr, lineStr);
+    sprintf(lineStr, "Throughput: %.3f processes per second\n",
+                                                    metricsPtr->throughput);
+    logText(logPtr, lineStr);
+
+    // display arrival rate, if processes arrived over time
+    if (metricsPtr->arrivalRate > 0.0)
+       {
+        sprintf(lineStr, "Arrival rate: %.3f processes per second\n",
+                                                  metricsPtr->arrivalRate);
+        logText(logPtr, lineStr);
+       }
+   }
+
+/*
+ * Function Name: writeMetricsCsv
+ * Algorithm: writes one CSV row per process, then average and maximum
+ *            rows, then a separate block of system-wide metric/value rows
+ * Precondition: given output file name, computed metrics, and PCBs of the
+ *               run
+ * Postcondition: CSV file written, True returned on success
+ * Exceptions: file that cannot be opened or written returns False
+ * Notes: all times in seconds; blocks are separated by a blank line
+ */
+Boolean writeMetricsCsv(char *fileName, SimMetrics *metricsPtr,
+                                                PCB *pcbArray, int numProcs)
+   {
+    // initialize function/variables
+    FILE *filePtr = fopen(fileName, "w");
+    PCB *pcbPtr;
+    int index;
+
+    // check for file not opened
+    if (filePtr == NULL)
+       {
+        return False;
+       }
+
+    // write per-process rows
+    fprintf(filePtr, "pid,arrival,first_run,completion,turnaround,waiting,"
+                                             "response,cpu_time,io_wait\n");
+    for (index = 0; index < numProcs; index++)
+       {
+        pcbPtr = &pcbArray[ index ];
+        fprintf(filePtr, "%d,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f,%.6f\n",
+                pcbPtr->pid, pcbPtr->arrivalTime, pcbPtr->firstRunTime,
+                pcbPtr->completionTime,
+                pcbPtr->completionTime - pcbPtr->arrivalTime,
+                pcbPtr->readyWaitTime,
+                pcbPtr->firstRunTime - pcbPtr->arrivalTime,
+                                     pcbPtr->cpuTime, pcbPtr->ioWaitTime);
+       }
+
+    // write aggregate rows
+    fprintf(filePtr, "avg,,,,%.6f,%.6f,%.6f,,%.6f\n",
+                    metricsPtr->avgTurnaround, metricsPtr->avgWaiting,
+                          metricsPtr->avgResponse, metricsPtr->avgIoWait);
+    fprintf(filePtr, "max,,,,%.6f,%.6f,%.6f,,\n", metricsPtr->maxTurnaround,
+                         metricsPtr->maxWaiting, metricsPtr->maxResponse);
+
+    // write system block
+    fprintf(filePtr, "\nmetric,value\n");
+    fprintf(filePtr, "processes,%d\n", metricsPtr->numProcs);
+    fprintf(filePtr, "cores,%d\n", metricsPtr->numCores);
+    fprintf(filePtr, "makespan,%.6f\n", metricsPtr->makespan);
+    fprintf(filePtr, "cpu_busy,%.6f\n", metricsPtr->cpuBusyTime);
+    fprintf(filePtr, "cpu_utilization,%.6f\n", metricsPtr->cpuUtilization);
+    fprintf(filePtr, "throughput,%.6f\n", metricsPtr->throughput);
+    fprintf(filePtr, "arrival_rate,%.6f\n", metricsPtr->arrivalRate);
+
+    // close file, reporting any write failure
+    return fclose(filePtr) == 0;
+   }
@@ -0,0 +1,46 @@
+// Preprocessor directive
+#ifndef SIM_METRICS_H
+#define SIM_METRICS_H
+
+// header files
+#include <stdio.h>
+#include "StringUtils.h"
+#include "Simulator.h"
+#include "SimLog.h"
+#include "MemoryMgr.h"
+
+// global constants
+#define NOT_YET_RUN -1.0
+#define PERCENT 100.0
+
+// system-wide scheduling measures of one run, in seconds unless noted;
+// averages and maximums are taken across every process; arrival rate is
+// zero when every process arrives at once
+typedef struct SimMetrics
+   {
+    int numProcs;
+    int numCores;
+    double makespan;
+    double cpuBusyTime;
+    double cpuUtilization;
+    double throughput;
+    double arrivalRate;
+    double avgTurnaround;
+    double avgWaiting;
+    double avgResponse;
+    double avgIoWait;
+    double maxTurnaround;
+    double maxWaiting;
+    double maxResponse;
+   } SimMetrics;
+
+// function prototypes
+void computeMetrics(SimMetrics *metricsPtr, PCB *pcbArray, int numProcs,
+                                                               int numCores);
+void logMemoryReport(SimLog *logPtr, MemoryMgr *mgrPtr, double endTime);
+void logMetricsReport(SimLog *logPtr, SimMetrics *metricsPtr,
+                                               PCB *pcbArray, int numProcs);
+Boolean writeMetricsCsv(char *fileName, SimMetrics *metricsPtr,
+                                               PCB *pcbArray, int numProcs);
+
+#endif // SIM_METRICS_H
@@ -0,0 +1,169 @@
+// header files
+#include "SimProfile.h"
+
+// profiler state shared by every thread; the list lock is only taken when
+// a thread first records a section, and when the report is written
+static pthread_mutex_t profileLock = PTHREAD_MUTEX_INITIALIZER;
+static ProfileCounters *profileList = NULL;
+static unsigned long long startTicks, startNanoseconds;
+static __thread ProfileCounters *threadCounters = NULL;
+__thread unsigned long long profileMarks[ NUM_PROFILE_SECTIONS ];
+
+// section names in report order, matching ProfileSection
+static const char *profileNames[ NUM_PROFILE_SECTIONS ] =
+   {
+    "run simulation",
+    "load program",
+    "schedule (getNextProcess)",
+    "service interrupts",
+    "start I/O",
+    "cpu op (pool job)",
+    "memory manager",
+    "log event",
+    "  format event text",
+    "core idle wait",
+    "sim lock wait"
+   };
+
+/*
+ * Function Name: profileAdd
+ * Algorithm: adds elapsed ticks and one call to the calling thread's
+ *            counters for a section, registering them on first use
+ * Precondition: given section and ticks elapsed in it
+ * Postcondition: thread counters updated
+ * Exceptions: none
+ * Notes: takes no lock after a thread's first call
+ */
+void profileAdd(ProfileSection section, unsigned long long ticks)
+   {
+    // register this thread's counters, if first use
+    if (threadCounters == NULL)
+       {
+        threadCounters = profileRegister();
+       }
+
+    // add to section totals
+    threadCounters->ticks[ section ] += ticks;
+    threadCounters->calls[ section ]++;
+   }
+
+/*
+ * Function Name: profileNanoseconds
+ * Algorithm: reads the monotonic clock in nanoseconds
+ * Precondition: none
+ * Postcondition: current time returned
+ * Exceptions: none
+ * Notes: used to calibrate the tick rate
+ */
+unsigned long long profileNanoseconds(void)
+   {
+    // initialize function/variables
+    struct timespec nowTime;
+
+    // read clock
+    clock_gettime(CLOCK_MONOTONIC, &nowTime);
+    return (unsigned long long)nowTime.tv_sec * PROFILE_NSEC_PER_SEC
+                                      + (unsigned long long)nowTime.tv_nsec;
+   }
+
+/*
+ * Function Name: profileRegister
+ * Algorithm: allocates zeroed counters and links them into the shared
+ *            list; the first registration also notes the calibration start
+ *            and arranges for the report at exit
+ * Precondition: none
+ * Postcondition: new thread counters returned
+ * Exceptions: none
+ * Notes: none
+ */
+ProfileCounters *profileRegister(void)
+   {
+    // initialize function/variables
+    ProfileCounters *countersPtr = calloc(1, sizeof(ProfileCounters));
+
+    // link counters, starting calibration on first registration
+    pthread_mutex_lock(&profileLock);
+    if (profileList == NULL)
+       {
+        startTicks = profileTicks();
+        startNanoseconds = profileNanoseconds();
+        atexit(&profileReport);
+       }
+    countersPtr->nextNode = profileList;
+    profileList = countersPtr;
+    pthread_mutex_unlock(&profileLock);
+
+    // return new counters
+    return countersPtr;
+   }
+
+/*
+ * Function Name: profileReport
+ * Algorithm: sums every thread's counters, converts ticks to time using
+ *            the tick rate seen since the first registration, writes one
+ *            line per section to standard error, then releases the
+ *            counters
+ * Precondition: called at exit
+ * Postcondition: breakdown written
+ * Exceptions: none
+ * Notes: sections nest, so percentages are of total run time and do not
+ *        sum to 100; times on several threads may exceed wall time
+ */
+void profileReport(void)
+   {
+    // initialize function/variables
+    unsigned long long ticks[ NUM_PROFILE_SECTIONS ] = { 0 };
+    unsigned long long calls[ NUM_PROFILE_SECTIONS ] = { 0 };
+    unsigned long long elapsedTicks, elapsedNanoseconds;
+    double nsPerTick = 1.0, runNanoseconds, sectionNanoseconds;
+    ProfileCounters *countersPtr, *nextPtr;
+    int section, numThreads = 0;
+
+    // sum counters of every thread, releasing them
+    pthread_mutex_lock(&profileLock);
+    elapsedTicks = profileTicks() - startTicks;
+    elapsedNanoseconds = profileNanoseconds() - startNanoseconds;
+    countersPtr = profileList;
+    while (countersPtr != NULL)
+       {
+        for (section = 0; section < NUM_PROFILE_SECTIONS; section++)
+           {
+            ticks[ section ] += countersPtr->ticks[ section ];
+            calls[ section ] += countersPtr->calls[ section ];
+           }
+        nextPtr = countersPtr->nextNode;
+        free(countersPtr);
+        countersPtr = nextPtr;
+        numThreads++;
+       }
+    profileList = NULL;
+    pthread_mutex_unlock(&profileLock);
+
+    // find tick rate
+    if (elapsedTicks > 0)
+       {
+        nsPerTick = (double)elapsedNanoseconds / (double)elapsedTicks;
+       }
+    runNanoseconds = ticks[ PROF_RUN_SIM ] * nsPerTick;
+
+    // write breakdown
+    fprintf(stderr, "\nSimulator profile (%d threads)\n", numThreads);
+    fprintf(stderr, "%-28s %12s %12s %12s %8s\n", "Section", "Calls",
+                                       "Total (ms)", "Avg (ns)", "% Run");
+    for (section = 0; section < NUM_PROFILE_SECTIONS; section++)
+       {
+        // skip sections never entered
+        if (calls[ section ] == 0)
+           {
+            continue;
+           }
+
+        sectionNanoseconds = ticks[ section ] * nsPerTick;
+        fprintf(stderr, "%-28s %12llu %12.3f %12.1f %8.1f\n",
+                profileNames[ section ], calls[ section ],
+                sectionNanoseconds / PROFILE_NSEC_PER_MSEC,
+                sectionNanoseconds / calls[ section ],
+                runNanoseconds > 0.0
+                   ? sectionNanoseconds * 100.0 / runNanoseconds : 0.0);
+       }
+   }
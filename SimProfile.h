@@ -0,0 +1,89 @@
+// Preprocessor directive
+#ifndef SIM_PROFILE_H
+#define SIM_PROFILE_H
+
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "StringUtils.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+// global constants
+#define PROFILE_NSEC_PER_SEC 1000000000ULL
+#define PROFILE_NSEC_PER_MSEC 1.0e6
+
+// simulator sections timed when built with -DSIM_PROFILE
+typedef enum
+   {
+    PROF_RUN_SIM,
+    PROF_LOAD_PROGRAM,
+    PROF_SCHEDULE,
+    PROF_INTERRUPT,
+    PROF_IO_START,
+    PROF_CPU_OP,
+    PROF_MEMORY,
+    PROF_LOG_EVENT,
+    PROF_LOG_FORMAT,
+    PROF_CORE_IDLE,
+    PROF_LOCK_WAIT,
+    NUM_PROFILE_SECTIONS
+   } ProfileSection;
+
+// one thread's tick and call counts per section; each thread updates only
+// its own, and every set stays linked for the report at exit
+typedef struct ProfileCounters
+   {
+    unsigned long long ticks[ NUM_PROFILE_SECTIONS ];
+    unsigned long long calls[ NUM_PROFILE_SECTIONS ];
+    struct ProfileCounters *nextNode;
+   } ProfileCounters;
+
+// scoped timer macros; a section's start is kept in a per-thread mark, so
+// sections may nest but a section may not enclose itself; without
+// SIM_PROFILE they expand to nothing, so normal builds pay nothing
+#ifdef SIM_PROFILE
+#define PROFILE_BEGIN(section) (profileMarks[ section ] = profileTicks())
+#define PROFILE_END(section) \
+           profileAdd(section, profileTicks() - profileMarks[ section ])
+#else
+#define PROFILE_BEGIN(section) ((void)0)
+#define PROFILE_END(section) ((void)0)
+#endif
+
+// start tick of each section open on the calling thread
+extern __thread unsigned long long profileMarks[ NUM_PROFILE_SECTIONS ];
+
+/*
+ * Function Name: profileTicks
+ * Algorithm: reads the time stamp counter where the processor has one,
+ *            otherwise the monotonic clock in nanoseconds
+ * Precondition: none
+ * Postcondition: current tick count returned
+ * Exceptions: none
+ * Notes: defined here so each timer reads inline; ticks are converted to
+ *        time once, when the report is written
+ */
+static inline unsigned long long profileTicks(void)
+   {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    struct timespec nowTime;
+
+    clock_gettime(CLOCK_MONOTONIC, &nowTime);
+    return (unsigned long long)nowTime.tv_sec * PROFILE_NSEC_PER_SEC
+                                      + (unsigned long long)nowTime.tv_nsec;
+#endif
+   }
+
+// function prototypes
+void profileAdd(ProfileSection section, unsigned long long ticks);
+unsigned long long profileNanoseconds(void);
+ProfileCounters *profileRegister(void);
+void profileReport(void);
+
+#endif // SIM_PROFILE_H
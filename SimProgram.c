@@ -0,0 +1,158 @@
+// header files
+#include "SimProgram.h"
+
+/*
+ * Function Name: buildProgram
+ * Algorithm: counts ops, processes, and device ops in the meta data list,
+ *            sizes every array from the arena in one pass, then copies and
+ *            decodes each op into its slot, recording process op ranges and
+ *            cycle totals and interning device names
+ * Precondition: given program storage and head of loaded meta data list
+ * Postcondition: program filled in; True returned, or False if an app
+ *                start has no matching app end
+ * Exceptions: none
+ * Notes: meta data list is not modified and may be released afterward
+ */
+Boolean buildProgram(SimProgram *programPtr, OpCodeType *headPtr)
+   {
+    // initialize function/variables
+    OpCodeType *iterator;
+    int numOps = 0, numProcs = 0, numDevOps = 0, opIndex = 0;
+    OpKind kind;
+    Boolean inProcess = False;
+
+    // count ops, processes, and device ops
+    for (iterator = headPtr; iterator != NULL; iterator = iterator->nextNode)
+       {
+        kind = decodeOpKind(iterator->command, iterator->inOutArg,
+                                                          iterator->strArg1);
+        numOps++;
+        numProcs += kind == OP_APP_START;
+        numDevOps += kind == OP_DEV_IN || kind == OP_DEV_OUT;
+       }
+
+    // allocate all program arrays from one arena
+    initArena(&programPtr->arena, 0);
+    programPtr->numOps = numOps;
+    programPtr->opKind = arenaAlloc(&programPtr->arena, numOps + 1);
+    programPtr->opDevice = arenaAlloc(&programPtr->arena,
+                                                 sizeof(short) * (numOps + 1));
+    programPtr->opArg2 = arenaAlloc(&programPtr->arena,
+                                                   sizeof(int) * (numOps + 1));
+    programPtr->opArg3 = arenaAlloc(&programPtr->arena,
+                                                   sizeof(int) * (numOps + 1));
+    programPtr->numProcs = 0;
+    programPtr->procStartOp = arenaAlloc(&programPtr->arena,
+                                                 sizeof(int) * (numProcs + 1));
+    programPtr->procEndOp = arenaAlloc(&programPtr->arena,
+                                                 sizeof(int) * (numProcs + 1));
+    programPtr->procCpuCycles = arenaAlloc(&programPtr->arena,
+                                                 sizeof(int) * (numProcs + 1));
+    programPtr->procIoCycles = arenaAlloc(&programPtr->arena,
+                                                 sizeof(int) * (numProcs + 1));
+    programPtr->numDevices = 0;
+    programPtr->deviceNames = arenaAlloc(&programPtr->arena,
+                                               STD_STR_LEN * (numDevOps + 1));
+
+    // copy and decode each op
+    for (iterator = headPtr; iterator != NULL; iterator = iterator->nextNode)
+       {
+        // set op data
+        kind = decodeOpKind(iterator->command, iterator->inOutArg,
+                                                          iterator->strArg1);
+        programPtr->opKind[ opIndex ] = (unsigned char)kind;
+        programPtr->opArg2[ opIndex ] = iterator->intArg2;
+        programPtr->opArg3[ opIndex ] = iterator->intArg3;
+        programPtr->opDevice[ opIndex ] = NO_DEVICE;
+
+        // check for device op, intern its name; list ops carry no track
+        if (kind == OP_DEV_IN || kind == OP_DEV_OUT)
+           {
+            programPtr->opArg3[ opIndex ] = NO_TRACK;
+            programPtr->opDevice[ opIndex ] = (short)findProgramDevice(
+                                                programPtr, iterator->strArg1);
+            if (inProcess == True)
+               {
+                programPtr->procIoCycles[ programPtr->numProcs ]
+                                                         += iterator->intArg2;
+               }
+           }
+
+        // check for cpu op within a process
+        else if (kind == OP_CPU_PROCESS && inProcess == True)
+           {
+            programPtr->procCpuCycles[ programPtr->numProcs ]
+                                                         += iterator->intArg2;
+           }
+
+        // check for start of process op range
+        else if (kind == OP_APP_START)
+           {
+            programPtr->procStartOp[ programPtr->numProcs ] = opIndex;
+            programPtr->procCpuCycles[ programPtr->numProcs ] = 0;
+            programPtr->procIoCycles[ programPtr->numProcs ] = 0;
+            inProcess = True;
+           }
+
+        // check for end of process op range
+        else if (kind == OP_APP_END && inProcess == True)
+           {
+            programPtr->procEndOp[ programPtr->numProcs ] = opIndex;
+            programPtr->numProcs++;
+            inProcess = False;
+           }
+
+        // iterate to next op
+        opIndex++;
+       }
+
+    // return success unless a process was left open
+    return inProcess == False;
+   }
+
+/*
+ * Function Name: clearProgram
+ * Algorithm: releases the program arena, and with it every program array
+ * Precondition: given built program
+ * Postcondition: program memory returned to OS, counts reset
+ * Exceptions: none
+ * Notes: none
+ */
+void clearProgram(SimProgram *programPtr)
+   {
+    clearArena(&programPtr->arena);
+    programPtr->numOps = 0;
+    programPtr->numProcs = 0;
+    programPtr->numDevices = 0;
+   }
+
+/*
+ * Function Name: findProgramDevice
+ * Algorithm: searches the device name table, appending the name if new
+ * Precondition: given program under construction and device name
+ * Postcondition: device index returned
+ * Exceptions: none
+ * Notes: device counts are small, so a linear search is sufficient
+ */
+int findProgramDevice(SimProgram *programPtr, char *deviceName)
+   {
+    // initialize function/variables
+    int index;
+
+    // search existing names
+    for (index = 0; index < programPtr->numDevices; index++)
+       {
+        if (compareString(programPtr->deviceNames[ index ], deviceName)
+                                                                   == STR_EQ)
+           {
+            return index;
+           }
+       }
+
+    // append new name
+    copyString(programPtr->deviceNames[ index ], deviceName);
+    programPtr->numDevices++;
+
+    // return new index
+    return index;
+   }
@@ -0,0 +1,42 @@
+// Preprocessor directive
+#ifndef SIM_PROGRAM_H
+#define SIM_PROGRAM_H
+
+// header files
+#include "StringUtils.h"
+#include "metadataops.h"
+#include "Arena.h"
+#include "OpDecode.h"
+
+// global constants
+#define NO_DEVICE -1
+#define NO_TRACK -1
+
+// loaded program as parallel arrays indexed by op number; each process
+// owns the op range from its app start to its app end, with its cpu and
+// I/O cycle totals kept alongside, and every array lives in one arena so
+// the program is released in a single call; a device op's second number
+// is its track, NO_TRACK when the meta data gives none
+typedef struct SimProgram
+   {
+    Arena arena;
+    int numOps;
+    unsigned char *opKind;
+    short *opDevice;
+    int *opArg2;
+    int *opArg3;
+    int numProcs;
+    int *procStartOp;
+    int *procEndOp;
+    int *procCpuCycles;
+    int *procIoCycles;
+    int numDevices;
+    char (*deviceNames)[ STD_STR_LEN ];
+   } SimProgram;
+
+// function prototypes
+Boolean buildProgram(SimProgram *programPtr, OpCodeType *headPtr);
+void clearProgram(SimProgram *programPtr);
+int findProgramDevice(SimProgram *programPtr, char *deviceName);
+
+#endif // SIM_PROGRAM_H
@@ -1,11 +1,12 @@
 // header files
 #include "Simulator.h"
+#include "SimContext.h"
 
 /*
  * Function Name: runSim
  * Algorithm: master driver for simulator operations;
  *            conducts OS simulation with varying scheduling strageties
- *            and varying numbers of processes
+ *            and varying numbers of processes, displaying to the monitor
  * Precondition: given head pointer to config data and meta data
  * Postcondition: simulation is provided, file output is provided as configured
  * Exceptions: none
@@ -14,641 +15,1314 @@
 void runSim(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr)
    {
     // initialize function/variables
-    char timeStr[STD_STR_LEN];
-    char statusMessage[STD_STR_LEN];
-    FileNode *fileHeadPtr = NULL;
-    PCB *PCB_HeadPtr = NULL;
-    PCB *PCB_Iterator = NULL;
-    int logToCode = configPtr->logToCode;
-    int currPid;
-    OpCodeType *currOp;
-    char ioType[STD_STR_LEN];
-    pthread_t opThread;
-    int threadTime;
+    SimResult result;
 
+    // run simulation with standard output as monitor
+    runSimulation(configPtr, metaDataMstrPtr, stdout, &result);
+   }
 
-    MMU *memHead = NULL;
-    MMU *memIterator = memHead;
-    MMU *previous;
-    Boolean result;
+/*
+ * Function Name: admitProcess
+ * Algorithm: moves a newly arrived process from NEW to READY on the given
+ *            core and displays the state change
+ * Precondition: given new process, simulator context, and core id;
+ *               simulator lock held once cores are running
+ * Postcondition: process queued as ready
+ * Exceptions: none
+ * Notes: processes arriving at time zero are admitted before the cores
+ *        start, later ones when their arrival interrupt is serviced; the
+ *        process counts as ready from its scheduled arrival time, so any
+ *        delay in admitting it counts toward its waiting, response, and
+ *        turnaround times
+ */
+void admitProcess(PCB *pcbPtr, SimContext *simPtr, int coreId)
+   {
+    // queue process, ready since it arrived
+    setReady(pcbPtr, simPtr, coreId);
+    pcbPtr->stateTime = pcbPtr->arrivalTime;
+    logEvent(&simPtr->simLog, EVT_NEW_TO_READY, pcbPtr->pid, NULL, 0);
+   }
 
-    // display run banner
-    printf("Simulator Run");
-    printf("\n-------------\n\n");
+/*
+ * Function Name: ageLevels
+ * Algorithm: raises every ready process to the top priority level, starts
+ *            a new aging epoch so running and blocked processes are raised
+ *            when next scheduled, and sets the next aging time
+ * Precondition: given simulator context in multilevel mode; simulator lock
+ *               held
+ * Postcondition: lower level processes raised, aging event displayed
+ * Exceptions: none
+ * Notes: periodic raising keeps processes at low levels from starving
+ *        behind a steady stream of short bursts
+ */
+void ageLevels(SimContext *simPtr)
+   {
+    // initialize variables
+    double now = readClock(&simPtr->simClock);
+    int numRaised;
 
-    // start timer and display start message
-    // display is done manually for first line so that fileHeadPtr is not null
-    // when passed
-    accessTimer(ZERO_TIMER, timeStr);
-    sprintf(statusMessage, " %s, %s", timeStr, "OS: Simulator Start\n");
-    if (logToCode == LOGTO_MONITOR_CODE || logToCode == LOGTO_BOTH_CODE)
-       {
-        printf(statusMessage);
-       }
-    if (logToCode == LOGTO_FILE_CODE || logToCode == LOGTO_BOTH_CODE)
-       {
-        fileHeadPtr = addFileNode(fileHeadPtr, statusMessage);
-       }
+    // raise queued processes and start new epoch for the rest
+    numRaised = raiseCoreLevels(&simPtr->cores);
+    simPtr->agingEpoch++;
+    logEvent(&simPtr->simLog, EVT_LEVELS_AGED, 0, NULL, numRaised);
 
-    // if logging solely to file, notify user
-    if (configPtr->logToCode == LOGTO_FILE_CODE)
+    // set next aging time, skipping any intervals passed while idle
+    while (simPtr->nextAgingTime <= now)
        {
-        printf("Logging output to file: %s\n", configPtr->logToFileName);
+        simPtr->nextAgingTime = timeAfter(simPtr->nextAgingTime,
+                                         simPtr->configPtr->mlfqAgingTime);
        }
+   }
 
-    // initialize PCBs
-    PCB_HeadPtr = initializePCBs(PCB_HeadPtr, metaDataMstrPtr->nextNode,
-                                                                configPtr, 0);
+/*
+ * Function Name: endCpuBurst
+ * Algorithm: folds the cpu time run since the process last blocked, or
+ *            since it started, into its predicted next burst by exponential
+ *            averaging, tau = alpha * burst + (1 - alpha) * tau, then
+ *            starts a new burst
+ * Precondition: given process leaving the cpu to wait and simulator
+ *               context
+ * Postcondition: prediction updated if burst prediction is in use, burst
+ *                time cleared
+ * Exceptions: none
+ * Notes: a burst spans quantum slices and preemptions, ending only when
+ *        the process blocks
+ */
+void endCpuBurst(PCB *pcbPtr, SimContext *simPtr)
+   {
+    // initialize variables
+    double alpha = simPtr->configPtr->burstAlpha;
 
-    // set and display PCB states
-    PCB_Iterator = PCB_HeadPtr;
-    while (PCB_Iterator != NULL)
+    // average finished burst into prediction
+    if (usesBurstPrediction(simPtr->configPtr) == True)
        {
-        // set current PCB's state to ready
-        PCB_Iterator->currState = READY;
+        pcbPtr->predictedBurst = alpha * pcbPtr->burstTime
+                                   + (1.0 - alpha) * pcbPtr->predictedBurst;
+       }
+    pcbPtr->burstTime = 0.0;
+   }
 
-        // display updated state
-        accessTimer(LAP_TIMER, timeStr);
-        sprintf(statusMessage,
-                     " %s, OS: Process %d set to READY state from NEW state,\n",
-                                                   timeStr, PCB_Iterator->pid);
-        updateDisplay(statusMessage, logToCode, fileHeadPtr);
+/*
+ * Function Name: getNextProcess
+ * Algorithm: keeps the last process on the cpu while it is still running,
+ *            otherwise takes the next process from the core's ready queue,
+ *            whose ordering implements the configured scheduling algorithm,
+ *            or steals one from another core when the core's own is empty,
+ *            charging the selected process the time it waited ready and
+ *            starting its round robin quantum afresh; a process just
+ *            preempted that is taken again continues without display,
+ *            otherwise its preemption is displayed before the process
+ *            replacing it
+ * Precondition: given pointer to PCB of last process run on this core,
+ *               PCB of process just preempted on this core or NULL,
+ *               simulator context, and core id; simulator lock held
+ * Postcondition: pointer to next process returned, or NULL if no active
+ *                process is ready on any core
+ * Exceptions: none
+ * Notes: dispatch and steal events are only displayed with several cores
+ */
+PCB *getNextProcess(PCB *localPtr, PCB *preemptedPtr, SimContext *simPtr,
+                                                                 int coreId)
+   {
+    // initialize variables
+    SimLog *logPtr = &simPtr->simLog;
+    double dispatchTime;
+    int fromCore;
 
-        // iterate to next pointer
-        PCB_Iterator = PCB_Iterator->nextNode;
+    // check for last process still holding the cpu
+    if (localPtr != NULL && localPtr->currState == RUNNING)
+       {
+        return localPtr;
        }
 
-    // reset PCB iterator
-    PCB_Iterator = PCB_HeadPtr;
+    // take next process in scheduling order
+    localPtr = popCoreReady(&simPtr->cores, coreId, &fromCore);
 
-    // loop until simulator complete
-    while ( simComplete( PCB_HeadPtr ) == False )
+    // check for no ready process available
+    if (localPtr == NULL)
        {
-        // get next PCB
-        PCB_Iterator = getNextProcess(PCB_Iterator, configPtr->cpuSchedCode,
-                                                logToCode, fileHeadPtr, PCB_HeadPtr);
+        return NULL;
+       }
 
-        //PCB_Iterator = PCB_HeadPtr;
-        currPid = PCB_Iterator->pid;
+    // check for preempted process still first in order, which keeps the
+    // cpu as if never interrupted
+    if (localPtr == preemptedPtr)
+       {
+        localPtr->currState = RUNNING;
+        return localPtr;
+       }
 
-        // set next op code
-        PCB_Iterator->opCodePtr = PCB_Iterator->opCodePtr->nextNode;
-        currOp = PCB_Iterator->opCodePtr;
+    // display preemption of process being replaced, noting cpu op cut
+    // short
+    if (preemptedPtr != NULL)
+       {
+        if (preemptedPtr->cyclesLeft > 0)
+           {
+            logEvent(logPtr, EVT_CPU_PREEMPTED, preemptedPtr->pid, NULL, 0);
+           }
+        logEvent(logPtr, EVT_RUNNING_TO_READY, preemptedPtr->pid, NULL, 0);
+       }
 
+    // start a new round robin quantum; a multilevel quantum instead
+    // lasts until the process changes level
+    if (simPtr->levelMode == False)
+       {
+        localPtr->quantumUsed = 0;
+       }
 
-        // check for I/O op
-        if (compareString(currOp->inOutArg, "in") == STR_EQ ||
-            compareString(currOp->inOutArg, "out") == STR_EQ)
-           {
-            // determine type of I/O for display
-            accessTimer(LAP_TIMER, timeStr);
-            if (compareString(currOp->inOutArg, "in") == STR_EQ)
-               {
-                copyString(ioType, "input");
-               }
-            else
-               {
-                copyString(ioType, "output");
-               }
+    // account for time spent ready, noting first time on a cpu
+    dispatchTime = readClock(&simPtr->simClock);
+    localPtr->readyWaitTime += dispatchTime - localPtr->stateTime;
+    if (localPtr->firstRunTime < 0.0)
+       {
+        localPtr->firstRunTime = dispatchTime;
+       }
 
-            // display start of I/O op
-            sprintf(statusMessage,
-                            " %s, Process: %d, %s %s operation start\n",
-                            timeStr, currPid, currOp->strArg1, ioType);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-
-            // perform I/O op using thread
-            threadTime = currOp->intArg2 * configPtr->ioCycleRate;
-            pthread_create(&opThread, NULL, &threadOp, &threadTime);
-            pthread_join(opThread, NULL);
-
-            // display I/O op end
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                            " %s, Process: %d, %s %s operation end\n",
-                            timeStr, currPid, currOp->strArg1, ioType);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-           }
+    // display new process selected
+    logEvent(logPtr, EVT_PROC_SELECTED, localPtr->pid, NULL,
+                                              (int)localPtr->timeRemaining);
 
-        // otherwise, check for cpu op
-        else if (compareString(currOp->strArg1, "process") == STR_EQ)
+    // display core taking process, if more than one
+    if (simPtr->cores.numCores > 1)
+       {
+        if (fromCore != coreId)
            {
-            // display start of cpu op
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                        " %s, Process: %d, cpu process operation start\n",
-                                                         timeStr, currPid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-
-            // perform cpu op
-            threadTime = currOp->intArg2 * configPtr->procCycleRate;
-            pthread_create(&opThread, NULL, &threadOp, &threadTime);
-            pthread_join(opThread, NULL);
-
-            // display end of cpu op
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                         " %s, Process: %d, cpu process operation end\n",
-                                                        timeStr, currPid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
+            logEvent(logPtr, EVT_WORK_STOLEN, localPtr->pid, NULL, coreId);
            }
+        logEvent(logPtr, EVT_CORE_DISPATCH, localPtr->pid, NULL, coreId);
+       }
 
-        // otherwise, check for memory access or allocation
-        else if ( compareString(currOp->command, "mem") == STR_EQ )
-            {
+    // set selected process to running and display state change
+    localPtr->currState = RUNNING;
+    logEvent(logPtr, EVT_READY_TO_RUNNING, localPtr->pid, NULL, 0);
 
-            // check for allocating memory command
-            if ( compareString(currOp->strArg1, "allocate") == STR_EQ )
-              {
-                accessTimer( LAP_TIMER, timeStr );
-                sprintf(statusMessage,
-                      " %s, Process: %d, attempting mem allocate request\n",
-                                                timeStr, currPid);
-                updateDisplay(statusMessage, logToCode, fileHeadPtr);
+    // return selected process
+    return localPtr;
+   }
 
+/*
+ * Function Name: handleInterrupt
+ * Algorithm: admits the process of an arrival request; otherwise services
+ *            a completed I/O request by displaying its end, charging its
+ *            time and time blocked to the process, and moving the process
+ *            from BLOCKED back to READY on the servicing core, then
+ *            letting its device move on to its next request
+ * Precondition: given completed request taken from the interrupt queue,
+ *               simulator context, and id of servicing core; simulator lock
+ *               held
+ * Postcondition: owning process is queued as ready, request memory
+ *                returned to OS
+ * Exceptions: none
+ * Notes: none
+ */
+void handleInterrupt(IoRequest *requestPtr, SimContext *simPtr, int coreId)
+   {
+    // initialize variables
+    PCB *ownerPtr = requestPtr->ownerPtr;
+    SimLog *logPtr = &simPtr->simLog;
 
-              if ( memHead == NULL )
-                  {
-                   // returns a new mem node with a boolean value attached
-                   memHead = addMem( memHead, currOp->intArg2, currOp->intArg3, configPtr );
-                   memIterator = memHead;
-                  }
-              else
-                {
-                  // returns a new mem node with a boolean calue attached
-                  previous = memIterator;
-                  memIterator = addMem( memHead, currOp->intArg2, currOp->intArg3, configPtr);
-                  previous->nextNode = memIterator;
-                }
-
-              // check if allocation is possible
-              if ( memIterator->mmuResult == True )
-                {
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, successful mem allocate request\n",
-                                                  timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                }
-              // failed allocation attempt
-              else
-                {
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, failed mem allocate request\n",
-                                                  timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                  PCB_Iterator->currState = EXIT;
-
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, experiences segmentation fault\n",
-                                                  timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                }
-              }
+    // check for process arriving
+    if (requestPtr->isArrival == True)
+       {
+        admitProcess(ownerPtr, simPtr, coreId);
+        free(requestPtr);
+        return;
+       }
 
-            // if not allocate, then it must be access
-            else
-              {
-                accessTimer( LAP_TIMER, timeStr );
-                sprintf(statusMessage,
-                      " %s, Process: %d, attempting mem access request\n",
-                                                timeStr, currPid);
-                updateDisplay(statusMessage, logToCode, fileHeadPtr);
-
-                // retrieves a boolean value if it could fit in one of the data blocks
-                result = memAccess( memHead, currOp->intArg2, currOp->intArg3 );
-
-              // if result is false
-              if ( result == False )
-                {
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, failed mem access request\n",
-                                                  timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                  PCB_Iterator->currState = EXIT;
-
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, experiences segmentation fault\n",
-                                                  timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                }
-              else
-                {
-                  accessTimer( LAP_TIMER, timeStr );
-                  sprintf(statusMessage,
-                        " %s, Process: %d, successful mem access request\n",
-                                                    timeStr, currPid);
-                  updateDisplay(statusMessage, logToCode, fileHeadPtr);
-                }
-              }
-            }
+    // display interrupt and I/O op end
+    logEvent(logPtr, EVT_IO_INTERRUPT, requestPtr->pid,
+                               requestPtr->deviceName, requestPtr->isInput);
+    logEvent(logPtr, EVT_IO_END, requestPtr->pid,
+                               requestPtr->deviceName, requestPtr->isInput);
+
+    // account for I/O time and time blocked, then return process to ready
+    // state
+    ownerPtr->timeRemaining -= requestPtr->ioTime;
+    ownerPtr->ioWaitTime += readClock(&simPtr->simClock)
+                                                     - ownerPtr->stateTime;
+    setReady(ownerPtr, simPtr, coreId);
+    logEvent(logPtr, EVT_BLOCKED_TO_READY, requestPtr->pid, NULL, 0);
+
+    // start device's next queued request, if devices are modeled
+    if (simPtr->deviceMode == True)
+       {
+        completeDeviceIo(&simPtr->devices, requestPtr);
+       }
 
-        // check for end of process
-        if (compareString(currOp->strArg1, "end") == STR_EQ || PCB_Iterator->currState == EXIT)
-           {
-            // display process end
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage, "\n %s, OS: Process %d ended\n",
-                                                  timeStr, PCB_Iterator->pid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-
-            // set PCB state to exit
-            PCB_Iterator->currState = EXIT;
-
-            // display state change
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                     " %s, OS: Process %d set to EXIT\n",
-                                     timeStr, PCB_Iterator->pid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-           }
+    // release request memory
+    free(requestPtr);
+   }
 
-        // otherwise, assume not at end of process
-        else
-           {
-            // set PCB state back to ready
-            PCB_Iterator->currState = READY;
-           }
-       }
+/*
+ * Function Name: hasWorkLeft
+ * Algorithm: checks for cycles left in the current cpu op, otherwise for
+ *            any op before the process's app end
+ * Precondition: given process between ops and simulator context
+ * Postcondition: True returned if the process has more than its app end
+ *                left to run
+ * Exceptions: none
+ * Notes: a process whose quantum runs out as its last op ends keeps the
+ *        cpu to exit, rather than waiting again for nothing
+ */
+Boolean hasWorkLeft(PCB *pcbPtr, SimContext *simPtr)
+   {
+    return pcbPtr->cyclesLeft > 0
+        || simPtr->program.opKind[ pcbPtr->opIndex + 1 ] != OP_APP_END;
+   }
 
-    // display end of opeations
-    accessTimer(LAP_TIMER, timeStr);
-    sprintf(statusMessage, " %s, OS: System stop\n", timeStr);
-    updateDisplay(statusMessage, logToCode, fileHeadPtr);
+/*
+ * Function Name: isPreemptive
+ * Algorithm: checks scheduling code for one of the preemptive strategies
+ * Precondition: given scheduling code
+ * Postcondition: True returned for FCFS-P, SRTF-P, RR-P, and MLFQ-P
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean isPreemptive(int schedCode)
+   {
+    return schedCode == CPU_SCHED_FCFS_P_CODE
+        || schedCode == CPU_SCHED_SRTF_P_CODE
+        || schedCode == CPU_SCHED_RR_P_CODE
+        || schedCode == CPU_SCHED_MLFQ_P_CODE;
+   }
 
-    // dislay end of sim
-    accessTimer(LAP_TIMER, timeStr);
-    sprintf(statusMessage, " %s, OS: Simulation end\n", timeStr);
-    updateDisplay(statusMessage, logToCode, fileHeadPtr);
+/*
+ * Function Name: initializePCBs
+ * Algorithm: allocates one PCB per process from the program arena and sets
+ *            each one's op position, its arrival from its app start op's
+ *            time in ms, and its total cpu and I/O time from the program's
+ *            cycle totals, with its other timestamps cleared
+ * Precondition: given built program and config data
+ * Postcondition: array of PCBs in NEW state returned, indexed by pid
+ * Exceptions: none
+ * Notes: PCB array is released along with the program
+ */
+PCB *initializePCBs(SimProgram *programPtr, ConfigDataType *configPtr)
+   {
+    //initialize variables
+    PCB *pcbArray = arenaAlloc(&programPtr->arena,
+                                         sizeof(PCB) * programPtr->numProcs);
+    int currPid;
 
-    // print output to file, if configured to do so
-    if (logToCode == LOGTO_FILE_CODE || logToCode == LOGTO_BOTH_CODE)
+    // loop across processes
+    for (currPid = 0; currPid < programPtr->numProcs; currPid++)
        {
-        outputToFile(fileHeadPtr, configPtr->logToFileName);
+        // initialize PCB values, positioned on its app start op
+        pcbArray[ currPid ].pid = currPid;
+        pcbArray[ currPid ].currState = NEW;
+        pcbArray[ currPid ].cyclesLeft = 0;
+        pcbArray[ currPid ].opIndex = programPtr->procStartOp[ currPid ];
+
+        // initialize PCB timestamps and accumulated times
+        pcbArray[ currPid ].arrivalTime = programPtr->opArg2[
+                           programPtr->procStartOp[ currPid ] ] / MS_PER_SEC;
+        pcbArray[ currPid ].firstRunTime = NOT_YET_RUN;
+        pcbArray[ currPid ].completionTime = 0.0;
+        pcbArray[ currPid ].stateTime = 0.0;
+        pcbArray[ currPid ].cpuTime = 0.0;
+        pcbArray[ currPid ].readyWaitTime = 0.0;
+        pcbArray[ currPid ].ioWaitTime = 0.0;
+
+        // start burst prediction from a fixed guess, as no burst has run
+        pcbArray[ currPid ].predictedBurst = INITIAL_BURST_CYCLES
+                                                  * configPtr->procCycleRate;
+        pcbArray[ currPid ].burstTime = 0.0;
+
+        // start at top priority level with a full quantum
+        pcbArray[ currPid ].schedLevel = 0;
+        pcbArray[ currPid ].quantumUsed = 0;
+        pcbArray[ currPid ].levelEpoch = 0;
+
+        // calculate remaining time
+        pcbArray[ currPid ].timeRemaining
+                 = programPtr->procIoCycles[ currPid ] * configPtr->ioCycleRate
+                 + programPtr->procCpuCycles[ currPid ]
+                                                   * configPtr->procCycleRate;
        }
 
-    // free allocated memory
-    fileHeadPtr = clearFileData(fileHeadPtr);
-    PCB_HeadPtr = clearPCB_Data(PCB_HeadPtr);
+    // return PCB array
+    return pcbArray;
    }
 
 /*
- * Function Name: addFileNode
- * Algorithm: recursively adds an output string to the file linked list for
- *            future printing
- * Precondition: given pointer to node in file linked list and c-style string
- *               to be added in new node
- * Postcondition: new node added to linked list with given string to print,
- *                pointer to head node returned
+ * Function Name: refreshLevel
+ * Algorithm: returns the process to the top level with a full quantum if
+ *            an aging pass has run since its level was last checked
+ * Precondition: given process and simulator context in multilevel mode
+ * Postcondition: process level current for the aging epoch
  * Exceptions: none
- * Note: none
+ * Notes: none
  */
-FileNode *addFileNode(FileNode *localPtr, char* outputStr)
+void refreshLevel(PCB *pcbPtr, SimContext *simPtr)
    {
-    // check for null node, insert new node there
-    if (localPtr == NULL)
+    if (pcbPtr->levelEpoch != simPtr->agingEpoch)
        {
-        localPtr = (FileNode*)malloc(sizeof(FileNode));
-        copyString(localPtr->printStr, outputStr);
-        localPtr->nextNode = NULL;
-        return localPtr;
+        pcbPtr->schedLevel = 0;
+        pcbPtr->quantumUsed = 0;
+        pcbPtr->levelEpoch = simPtr->agingEpoch;
        }
-
-    // recurse to next node if localPtr not null
-    localPtr->nextNode = addFileNode(localPtr->nextNode, outputStr);
-
-    // return local pointer
-    return localPtr;
    }
 
 /*
- * Function Name: clearFileData
- * Algorithm: recursively iterates through file linked list, returns memory
- *            to OS from the bottom of the list upward
- * Precondition: given linked list, with or without data
- * Postcondition: all node memory, if any, is returned to OS, return pointer
- *                (head) is set to null
+ * Function Name: runCore
+ * Algorithm: dispatch loop of one simulated cpu; checks for preemption,
+ *            services completed I/O, then runs the next op of the process
+ *            it selects, until no active process remains; with one core an
+ *            idle cpu waits for the next interrupt, with several an idle
+ *            core sleeps until work is queued or an interrupt is raised
+ * Precondition: given core data holding its id and the shared simulator
+ *               context
+ * Postcondition: every process has reached EXIT
  * Exceptions: none
- * Notes: none
+ * Notes: matches the pthread start routine signature; holds the simulator
+ *        lock except while waiting
  */
-FileNode *clearFileData(FileNode *localPtr)
+void *runCore(void *corePtr)
    {
-    // check for localPtr not null
-    if (localPtr != NULL)
+    // initialize function/variables
+    SimCore *core = corePtr;
+    SimContext *simPtr = core->simPtr;
+    Boolean multiCore = simPtr->cores.numCores > 1;
+    PCB *currPtr = NULL;
+    PCB *lastRunPtr, *preemptedPtr;
+    Boolean dispatched;
+    IoRequest *requestPtr;
+    long wakeCount = 0;
+
+    // loop until simulator complete
+    PROFILE_BEGIN(PROF_LOCK_WAIT);
+    pthread_mutex_lock(&simPtr->simLock);
+    PROFILE_END(PROF_LOCK_WAIT);
+    while ( simComplete( &simPtr->cores ) == False )
        {
-        // recurse to next pointer
-        clearFileData(localPtr->nextNode);
+        // check for interrupt arriving during a preemptive cpu slice,
+        // which forces a new scheduling decision unless the process has
+        // only its app end left
+        lastRunPtr = currPtr;
+        preemptedPtr = NULL;
+        if (simPtr->preemptive == True && lastRunPtr != NULL
+            && lastRunPtr->currState == RUNNING
+            && hasWorkLeft(lastRunPtr, simPtr) == True
+            && interruptPending(&simPtr->interrupts) == True)
+           {
+            // return process to this core's ready queue, displaying the
+            // preemption only if another process is dispatched
+            preemptedPtr = lastRunPtr;
+            setReady(lastRunPtr, simPtr, core->coreId);
+           }
+
+        // note wake count before looking for work, so work arriving after
+        // the search still wakes this core
+        if (multiCore == True)
+           {
+            wakeCount = readWakeCount(&simPtr->cores);
+           }
+
+        // return processes with completed I/O to ready state
+        PROFILE_BEGIN(PROF_INTERRUPT);
+        requestPtr = takeInterrupt(&simPtr->interrupts, False);
+        while (requestPtr != NULL)
+           {
+            handleInterrupt(requestPtr, simPtr, core->coreId);
+            requestPtr = takeInterrupt(&simPtr->interrupts, False);
+           }
+        PROFILE_END(PROF_INTERRUPT);
+
+        // raise waiting processes to the top level when aging is due
+        if (simPtr->levelMode == True && simPtr->configPtr->mlfqAgingTime > 0
+            && readClock(&simPtr->simClock) >= simPtr->nextAgingTime)
+           {
+            ageLevels(simPtr);
+           }
+
+        // check for a higher priority process ready on this core, raised
+        // by an aging pass or left waiting when the last quantum slice
+        // ended, which preempts a lower level process in multilevel mode
+        // unless it has only its app end left
+        if (simPtr->levelMode == True && lastRunPtr != NULL
+            && lastRunPtr->currState == RUNNING
+            && hasWorkLeft(lastRunPtr, simPtr) == True)
+           {
+            // raise running process first if aging has run, as aging
+            // raises every process, not only those waiting
+            refreshLevel(lastRunPtr, simPtr);
+            if (topCoreLevel(&simPtr->cores, core->coreId)
+                                                  < lastRunPtr->schedLevel)
+               {
+                preemptedPtr = lastRunPtr;
+                setReady(lastRunPtr, simPtr, core->coreId);
+               }
+           }
+
+        // get next PCB, noting whether it is newly dispatched from a ready
+        // queue rather than a preempted process continuing
+        dispatched = lastRunPtr == NULL || lastRunPtr->currState != RUNNING;
+        PROFILE_BEGIN(PROF_SCHEDULE);
+        currPtr = getNextProcess(lastRunPtr, preemptedPtr, simPtr,
+                                                              core->coreId);
+        PROFILE_END(PROF_SCHEDULE);
+        if (currPtr != NULL && currPtr == preemptedPtr)
+           {
+            dispatched = False;
+           }
+
+        // check for no ready process on any core
+        if (currPtr == NULL)
+           {
+            // sleep until another core or device has work for this one
+            if (multiCore == True)
+               {
+                pthread_mutex_unlock(&simPtr->simLock);
+                PROFILE_BEGIN(PROF_CORE_IDLE);
+                waitForCoreWork(&simPtr->cores, wakeCount);
+                PROFILE_END(PROF_CORE_IDLE);
+                PROFILE_BEGIN(PROF_LOCK_WAIT);
+                pthread_mutex_lock(&simPtr->simLock);
+                PROFILE_END(PROF_LOCK_WAIT);
+               }
+
+            // otherwise, every active process is blocked
+            else
+               {
+                // display idle cpu and wait for next I/O completion
+                logEvent(&simPtr->simLog, EVT_CPU_IDLE, 0, NULL, 0);
+                pthread_mutex_unlock(&simPtr->simLock);
+                PROFILE_BEGIN(PROF_CORE_IDLE);
+                requestPtr = takeInterrupt(&simPtr->interrupts, True);
+                PROFILE_END(PROF_CORE_IDLE);
+
+                // display end of idle and service interrupt
+                pthread_mutex_lock(&simPtr->simLock);
+                logEvent(&simPtr->simLog, EVT_CPU_IDLE_END, 0, NULL, 0);
+                handleInterrupt(requestPtr, simPtr, core->coreId);
+               }
 
-        // release memory to OS and set current node to null
-        free(localPtr);
-        localPtr = NULL;
+            // return to scheduling
+            continue;
+           }
+
+        // run next op of selected process
+        runProcessOp(currPtr, dispatched, simPtr, core->coreId);
        }
-    // return null to calling function
+    pthread_mutex_unlock(&simPtr->simLock);
+
+    // exit core
     return NULL;
    }
 
 /*
- * Function Name: clearPCBData
- * Algorithm: recursively iterates through PCB linked list, returns memory
- *            to OS from the bottom of the list upward
- * Precondition: given linked list, with or without data
- * Postcondition: all node memory, if any, is returned to OS, return pointer
- *                (head) is set to null
+ * Function Name: runProcessOp
+ * Algorithm: advances the process to its next op, unless resuming a partly
+ *            run cpu op, and runs it by decoded kind: I/O is handed to a
+ *            device and blocks the process, cpu time is run whole or one
+ *            quantum at a time, and memory ops go to the paged or segmented
+ *            manager; then retires the process if it ended or faulted; in
+ *            multilevel mode, using up the level's quantum lowers the
+ *            process a level and blocking before then raises it one
+ * Precondition: given running process, whether it was just dispatched,
+ *               simulator context, and id of running core; simulator lock
+ *               held
+ * Postcondition: one op, or one quantum of a cpu op, has run
  * Exceptions: none
- * Notes: none
+ * Notes: simulator lock is released while a real time cpu op runs, so
+ *        other cores may proceed
  */
-PCB *clearPCB_Data(PCB *localPtr)
+void runProcessOp(PCB *pcbPtr, Boolean dispatched, SimContext *simPtr,
+                                                                  int coreId)
    {
-    // check for localPtr not null
-    if (localPtr != NULL)
+    // initialize function/variables
+    ConfigDataType *configPtr = simPtr->configPtr;
+    SimProgram *progPtr = &simPtr->program;
+    SimLog *logPtr = &simPtr->simLog;
+    int currPid = pcbPtr->pid;
+    int currOp, sliceCycles, threadTime, quantum;
+    int memBase, memSize, pageFaults, numAhead = 0;
+    long compactions, fitFailures;
+    Boolean isInput, result;
+    char *deviceName;
+    IoRequest *requestPtr;
+
+    // set next op code, unless resuming a partly run cpu op
+    if (pcbPtr->cyclesLeft == 0)
        {
-        // recurse to next pointer
-        clearPCB_Data(localPtr->nextNode);
+        pcbPtr->opIndex++;
+       }
+    currOp = pcbPtr->opIndex;
 
-        // release memory to OS and set current node to null
-        free(localPtr);
-        localPtr = NULL;
+    // find quantum, the rest of the level's quantum in multilevel mode or
+    // of the dispatch's quantum in round robin
+    quantum = configPtr->quantumCycles;
+    if (simPtr->levelMode == True)
+       {
+        refreshLevel(pcbPtr, simPtr);
+        quantum = simPtr->levelQuanta[ pcbPtr->schedLevel ]
+                                                      - pcbPtr->quantumUsed;
+       }
+    else if (configPtr->cpuSchedCode == CPU_SCHED_RR_P_CODE)
+       {
+        quantum = configPtr->quantumCycles - pcbPtr->quantumUsed;
        }
 
-    // return null to calling function
-    return NULL;
-   }
+    // dispatch on decoded op kind
+    switch (progPtr->opKind[ currOp ])
+       {
+        // I/O op
+        case OP_DEV_IN:
+        case OP_DEV_OUT:
+           // determine type of I/O and display start of I/O op
+           isInput = progPtr->opKind[ currOp ] == OP_DEV_IN;
+           deviceName = progPtr->deviceNames[ progPtr->opDevice[ currOp ] ];
+           logEvent(logPtr, EVT_IO_START, currPid, deviceName, isInput);
+
+           // hand I/O op to its device's queue, or to a device worker when
+           // devices are not modeled; completion raises interrupt
+           PROFILE_BEGIN(PROF_IO_START);
+           requestPtr = createIoRequest(currPid,
+                  progPtr->opArg2[ currOp ] * configPtr->ioCycleRate, isInput,
+                                 deviceName, pcbPtr, &simPtr->interrupts);
+           if (simPtr->deviceMode == True)
+              {
+               requestPtr->deviceId = progPtr->opDevice[ currOp ];
+               requestPtr->trackNum
+                          = requestTrack(progPtr->opArg3[ currOp ], currOp);
+               numAhead = submitDeviceIo(&simPtr->devices, requestPtr);
+              }
+           else
+              {
+               scheduleIo(&simPtr->interrupts, requestPtr);
+              }
+           PROFILE_END(PROF_IO_START);
 
+           // display request waiting for its device
+           if (numAhead > 0)
+              {
+               logEvent(logPtr, EVT_IO_QUEUED, currPid, deviceName, numAhead);
+              }
 
-/* Function Name; getShortestProcess
- * Algorithm; returns a list of pcbs in a proper order of shortest to longest
- * Precondtion; a pointer to a pcb
- * Postcondition; a pointer of the head of a sorted list
+           // raise process giving up the cpu before its quantum ends
+           if (simPtr->levelMode == True && pcbPtr->schedLevel > 0)
+              {
+               setLevel(pcbPtr, simPtr, pcbPtr->schedLevel - 1);
+              }
 
- * 4-0-1-3-2 is the order it should go
- */
-PCB *getShortestProcess ( PCB *localPtr, PCB *head )
-    {
-    PCB *iterator = NULL;
-    PCB *shortestCurJob;
-    iterator = head;
-
-    if ( localPtr->currState == EXIT )
-      {
-        while ( iterator != NULL )
-          {
-            if( iterator->currState != EXIT )
+           // end cpu burst and block process until its interrupt is
+           // serviced
+           endCpuBurst(pcbPtr, simPtr);
+           pcbPtr->currState = BLOCKED;
+           pcbPtr->stateTime = readClock(&simPtr->simClock);
+
+           // display process blocked
+           logEvent(logPtr, EVT_IO_BLOCKED, currPid, NULL, isInput);
+           logEvent(logPtr, EVT_RUNNING_TO_BLOCKED, currPid, NULL, 0);
+           break;
+
+        // cpu op
+        case OP_CPU_PROCESS:
+           // display start of new cpu op, or of resumed op after dispatch
+           if (pcbPtr->cyclesLeft == 0)
+              {
+               pcbPtr->cyclesLeft = progPtr->opArg2[ currOp ];
+               logEvent(logPtr, EVT_CPU_START, currPid, NULL, 0);
+              }
+           else if (dispatched == True)
               {
-               localPtr = iterator;
+               logEvent(logPtr, EVT_CPU_START, currPid, NULL, 0);
               }
-            iterator = iterator->nextNode;
-          }
-      }
 
-    shortestCurJob = localPtr;
-    iterator = head;
+           // run whole op, or one quantum of it in preemptive modes
+           sliceCycles = pcbPtr->cyclesLeft;
+           if (simPtr->preemptive == True && quantum > 0
+                                                  && sliceCycles > quantum)
+              {
+               sliceCycles = quantum;
+              }
 
-    while ( iterator != NULL )
-      {
-        if ( iterator->timeRemaining < shortestCurJob->timeRemaining &&
-                                                  iterator->currState != EXIT )
-          {
-            shortestCurJob = iterator;
-            localPtr = iterator;
-          }
+           // perform cpu slice, advancing virtual time or on this core's
+           // cpu worker with other cores free to run meanwhile
+           threadTime = sliceCycles * configPtr->procCycleRate;
+           PROFILE_BEGIN(PROF_CPU_OP);
+           if (simPtr->simClock.virtualMode == True)
+              {
+               advanceClock(&simPtr->simClock, threadTime);
+              }
+           else
+              {
+               pthread_mutex_unlock(&simPtr->simLock);
+               runPoolJob(simPtr->cpuPool, &threadOp, &threadTime);
+               PROFILE_BEGIN(PROF_LOCK_WAIT);
+               pthread_mutex_lock(&simPtr->simLock);
+               PROFILE_END(PROF_LOCK_WAIT);
+              }
+           PROFILE_END(PROF_CPU_OP);
 
-        iterator = iterator->nextNode;
-      }
+           // account for cycles run
+           pcbPtr->cyclesLeft -= sliceCycles;
+           pcbPtr->timeRemaining -= threadTime;
+           pcbPtr->burstTime += threadTime;
+           pcbPtr->cpuTime += threadTime / MS_PER_SEC;
 
-    return shortestCurJob;
-    }
+           // check for end of cpu op
+           if (pcbPtr->cyclesLeft == 0)
+              {
+               logEvent(logPtr, EVT_CPU_END, currPid, NULL, 0);
+              }
 
+           // check for round robin quantum used up across the cpu ops of
+           // this dispatch, which ends the process's turn unless only its
+           // app end is left
+           if (configPtr->cpuSchedCode == CPU_SCHED_RR_P_CODE)
+              {
+               pcbPtr->quantumUsed += sliceCycles;
+               if (quantum > 0 && sliceCycles == quantum)
+                  {
+                   if (pcbPtr->cyclesLeft > 0)
+                      {
+                       logEvent(logPtr, EVT_QUANTUM_TIMEOUT, currPid,
+                                                                  NULL, 0);
+                      }
+                   if (hasWorkLeft(pcbPtr, simPtr) == True)
+                      {
+                       logEvent(logPtr, EVT_RUNNING_TO_READY, currPid,
+                                                                  NULL, 0);
+                       setReady(pcbPtr, simPtr, coreId);
+                      }
+                  }
+              }
 
+           // check for multilevel quantum used up, which lowers the
+           // process a level and ends its turn even if the op is done,
+           // unless only its app end is left
+           if (simPtr->levelMode == True)
+              {
+               pcbPtr->quantumUsed += sliceCycles;
+               if (quantum > 0 && sliceCycles == quantum)
+                  {
+                   if (pcbPtr->cyclesLeft > 0)
+                      {
+                       logEvent(logPtr, EVT_QUANTUM_TIMEOUT, currPid,
+                                                                  NULL, 0);
+                      }
+                   setLevel(pcbPtr, simPtr, pcbPtr->schedLevel + 1);
+                   if (hasWorkLeft(pcbPtr, simPtr) == True)
+                      {
+                       logEvent(logPtr, EVT_RUNNING_TO_READY, currPid,
+                                                                  NULL, 0);
+                       setReady(pcbPtr, simPtr, coreId);
+                      }
+                  }
+              }
+           break;
+
+        // memory allocation
+        case OP_MEM_ALLOCATE:
+           logEvent(logPtr, EVT_MEM_ALLOC_START, currPid, NULL, 0);
+           memBase = progPtr->opArg2[ currOp ];
+           memSize = progPtr->opArg3[ currOp ];
+
+           // map pages, or check for segment fitting in free memory
+           PROFILE_BEGIN(PROF_MEMORY);
+           compactions = simPtr->memory.compactions;
+           fitFailures = simPtr->memory.fitFailures;
+           if (simPtr->pagedMode == True)
+              {
+               result = allocatePages(&simPtr->pager, currPid, memBase,
+                                                                   memSize);
+              }
+           else
+              {
+               result = allocateSegment(&simPtr->memory, currPid, memBase,
+                                                                   memSize);
+              }
+           PROFILE_END(PROF_MEMORY);
+
+           // display compaction or fragmentation met placing segment, and
+           // update fragmentation, if segments are placed
+           if (simPtr->memory.fitCode != MEM_FIT_NONE_CODE)
+              {
+               if (simPtr->memory.compactions != compactions)
+                  {
+                   logEvent(logPtr, EVT_MEM_COMPACTED, currPid, NULL,
+                                               simPtr->memory.lastMoved);
+                  }
+               if (simPtr->memory.fitFailures != fitFailures)
+                  {
+                   logEvent(logPtr, EVT_MEM_FRAGMENTED, currPid, NULL,
+                                                                   memSize);
+                  }
+               updateFragmentation(&simPtr->memory,
+                                           readClock(&simPtr->simClock));
+              }
+
+           // check for successful allocation
+           if (result == True)
+              {
+               logEvent(logPtr, EVT_MEM_ALLOC_SUCCESS, currPid, NULL, 0);
+              }
+
+           // failed allocation attempt
+           else
+              {
+               logEvent(logPtr, EVT_MEM_ALLOC_FAIL, currPid, NULL, 0);
+               pcbPtr->currState = EXIT;
+               logEvent(logPtr, EVT_SEG_FAULT, currPid, NULL, 0);
+              }
+           break;
+
+        // memory access
+        case OP_MEM_ACCESS:
+           logEvent(logPtr, EVT_MEM_ACCESS_START, currPid, NULL, 0);
+           memBase = progPtr->opArg2[ currOp ];
+           memSize = progPtr->opArg3[ currOp ];
+
+           // translate pages, displaying any faults taken
+           PROFILE_BEGIN(PROF_MEMORY);
+           if (simPtr->pagedMode == True)
+              {
+               result = accessPages(&simPtr->pager, currPid, memBase, memSize,
+                                                               &pageFaults);
+               PROFILE_END(PROF_MEMORY);
+               if (pageFaults > 0)
+                  {
+                   logEvent(logPtr, EVT_PAGE_FAULT, currPid, NULL,
+                                                                 pageFaults);
+                  }
+              }
+
+           // otherwise, check process's own segments
+           else
+              {
+               result = accessSegment(&simPtr->memory, currPid, memBase,
+                                                                   memSize);
+               PROFILE_END(PROF_MEMORY);
+              }
+
+           // check for access outside the process's own memory
+           if (result == False)
+              {
+               logEvent(logPtr, EVT_MEM_ACCESS_FAIL, currPid, NULL, 0);
+               pcbPtr->currState = EXIT;
+               logEvent(logPtr, EVT_SEG_FAULT, currPid, NULL, 0);
+              }
+           else
+              {
+               logEvent(logPtr, EVT_MEM_ACCESS_SUCCESS, currPid, NULL, 0);
+              }
+           break;
+
+        // app end is handled below, nothing else runs
+        default:
+           break;
+       }
+
+    // check for end of process
+    if (progPtr->opKind[ currOp ] == OP_APP_END || pcbPtr->currState == EXIT)
+       {
+        // display process end
+        logEvent(logPtr, EVT_PROC_END, currPid, NULL, 0);
+
+        // set PCB state to exit and reclaim its memory
+        pcbPtr->currState = EXIT;
+        pcbPtr->completionTime = readClock(&simPtr->simClock);
+        PROFILE_BEGIN(PROF_MEMORY);
+        releaseProcessMemory(&simPtr->memory, currPid);
+        updateFragmentation(&simPtr->memory, pcbPtr->completionTime);
+        if (simPtr->pagedMode == True)
+           {
+            releaseProcessPages(&simPtr->pager, currPid);
+           }
+        PROFILE_END(PROF_MEMORY);
+
+        // display state change
+        logEvent(logPtr, EVT_PROC_EXIT, currPid, NULL, 0);
+        simPtr->cores.activeCount--;
+
+        // wake idle cores so they see the last process finish
+        if (simPtr->cores.activeCount == 0)
+           {
+            wakeCores(&simPtr->cores);
+           }
+       }
+   }
 
 /*
- * Function Name: getNextProcess
- * Algorithm: finds and returns the PCB of the next process to run based on
- *            the configured scheduling algorithm
- * Precondition: given pointer to PCB of last process run, scheduling code,
- *               and output information
- * Postcondition: pointer to next process returned
+ * Function Name: runProgram
+ * Algorithm: runs one complete simulation of a loaded program on one or
+ *            more cores, with its own clock, log, and monitor stream, so
+ *            that several may run side by side, then reports its totals,
+ *            scheduling metrics, memory placement, and device queue
+ *            statistics
+ * Precondition: given config data, program built by buildProgram or
+ *               mapProgramFile, monitor stream (NULL for none), and result
+ *               storage
+ * Postcondition: simulation is provided, file output is provided as
+ *                configured, result filled in, program released and
+ *                left empty; True returned
  * Exceptions: none
- * Notes: none
+ * Notes: virtual clock mode always runs a single core, since simulated time
+ *        has no meaning across concurrently running cores
  */
-PCB *getNextProcess(PCB *localPtr, int schedCode, int logToCode,
-                                        FileNode *fileHeadPtr, PCB *head)
+Boolean runProgram(ConfigDataType *configPtr, SimProgram *programPtr,
+                                      FILE *monitorPtr, SimResult *resultPtr)
    {
-    // initialize variables
+    // initialize function/variables
     char timeStr[STD_STR_LEN];
-    char statusMessage[STD_STR_LEN];
-    Boolean newProcess = False;
+    SimContext sim;
+    SimCore *coreArray;
+    PCB *pcbPtr;
+    int pcbIndex, coreId, numStarted, arrivalTime;
+    int numCores = 1;
+    int poolThreads = 0;
+    int numLater = 0;
 
-    // check for FCFS-N
-    if ( schedCode == CPU_SCHED_FCFS_N_CODE )
+    // display run banner
+    PROFILE_BEGIN(PROF_RUN_SIM);
+    resultPtr->completed = False;
+    if (monitorPtr != NULL)
        {
-        // check for local pointer in exit state
-        if (localPtr->currState == EXIT)
-           {
-            // set local pointer to next PCB
-            localPtr = localPtr->nextNode;
+        fprintf(monitorPtr, "Simulator Run");
+        fprintf(monitorPtr, "\n-------------\n\n");
+       }
 
-            // set new process flag
-            newProcess = True;
+    // take over loaded program
+    sim.program = *programPtr;
+    sim.configPtr = configPtr;
+    sim.preemptive = isPreemptive(configPtr->cpuSchedCode);
+    sim.pagedMode = configPtr->pageSize > 0;
+    sim.levelMode = configPtr->cpuSchedCode == CPU_SCHED_MLFQ_P_CODE;
+    sim.deviceMode = configPtr->ioSchedCode != IO_SCHED_NONE_CODE
+                                               && sim.program.numDevices > 0;
+    setLevelQuanta(&sim);
+
+    // start timer and output writers, then display start message
+    initSimClock(&sim.simClock, configPtr->virtualClock);
+    openSimLog(&sim.simLog, configPtr, &sim.simClock, monitorPtr);
+    accessClock(&sim.simClock, ZERO_TIMER, timeStr);
+    logEvent(&sim.simLog, EVT_SIM_START, 0, NULL, 0);
+
+    // if logging solely to file, notify user
+    if (configPtr->logToCode == LOGTO_FILE_CODE && monitorPtr != NULL)
+       {
+        // check for binary trace replacing text log file
+        if (getStringLength(configPtr->traceFileName) > 0)
+           {
+            fprintf(monitorPtr, "Logging trace to file: %s\n",
+                                                  configPtr->traceFileName);
+           }
+        else
+           {
+            fprintf(monitorPtr, "Logging output to file: %s\n",
+                                                  configPtr->logToFileName);
            }
+       }
 
+    // use configured cores only when op time is really run
+    if (sim.simClock.virtualMode == False && configPtr->numCores > 1)
+       {
+        numCores = configPtr->numCores;
+       }
+    initCoreSet(&sim.cores, numCores, usesReadyHeap(configPtr->cpuSchedCode),
+                                                             sim.numLevels);
+    numCores = sim.cores.numCores;
 
-        // check for new process selected or start of existing process
-        if (newProcess == True || compareString(localPtr->opCodePtr->strArg1,
-                                                                  "start") == STR_EQ)
-          {
-            // display new process selected
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                       " %s, OS: Process %d selected with %d ms remaining\n",
-                        timeStr, localPtr->pid, (int)localPtr->timeRemaining);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-
-            // display process state change
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                         " %s, OS: Process %d set from READY to RUNNING\n\n",
-                                                          timeStr, localPtr->pid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
-           }
+    // initialize PCBs
+    PROFILE_BEGIN(PROF_LOAD_PROGRAM);
+    sim.pcbArray = initializePCBs(&sim.program, configPtr);
+    PROFILE_END(PROF_LOAD_PROGRAM);
 
-         // set selected process to running
-         localPtr->currState = RUNNING;
+    // admit processes arriving at start, spreading them across core
+    // queues, and count those arriving later
+    for (pcbIndex = 0; pcbIndex < sim.program.numProcs; pcbIndex++)
+       {
+        pcbPtr = &sim.pcbArray[ pcbIndex ];
+        sim.cores.activeCount++;
+        if (pcbPtr->arrivalTime > 0.0)
+           {
+            numLater++;
+           }
+        else
+           {
+            admitProcess(pcbPtr, &sim, pcbPtr->pid % numCores);
+           }
 
-         // return local pointer
-         return localPtr;
+        // count one worker per process that may be blocked on I/O, up to
+        // the cap, so large workloads do not start a thread per process
+        if (poolThreads < MAX_IO_THREADS)
+           {
+            poolThreads++;
+           }
+       }
 
-        }
+    // count one service worker per device instead, if devices queue
+    // their requests
+    if (sim.deviceMode == True)
+       {
+        poolThreads = sim.program.numDevices;
+       }
 
-    // else, check SJF-N and
-    else if ( schedCode == CPU_SCHED_SJF_N_CODE )
-        {
+    // start long-lived I/O and device worker threads, with one more to
+    // raise later arrivals, and a cpu op worker per core, unless virtual
+    // clock mode is simulating op time without running it
+    sim.opPool = NULL;
+    sim.cpuPool = NULL;
+    if (sim.simClock.virtualMode == False)
+       {
+        sim.opPool = createWorkerPool(poolThreads + (numLater > 0 ? 1 : 0));
+        sim.cpuPool = createWorkerPool(numCores);
+       }
 
-        // give us a list of a now sorted list of PCBs
-        PCB *nextjobs = NULL;
-        nextjobs = getShortestProcess( localPtr, head );
+    // note when capped I/O workers may delay blocked processes' I/O
+    if (sim.opPool != NULL && sim.deviceMode == False
+                                  && sim.program.numProcs > MAX_IO_THREADS)
+       {
+        logEvent(&sim.simLog, EVT_IO_WORKERS_CAPPED, 0, NULL, MAX_IO_THREADS);
+       }
+    initInterruptQueue(&sim.interrupts, &sim.simClock, sim.opPool);
+    if (sim.deviceMode == True)
+       {
+        initDeviceSet(&sim.devices, sim.program.deviceNames,
+                     sim.program.numDevices, configPtr->ioSchedCode,
+                                   configPtr->ioSeekTime, &sim.interrupts);
+       }
 
+    // schedule later arrivals, each at its app start op's time in ms
+    for (pcbIndex = 0; numLater > 0 && pcbIndex < sim.program.numProcs;
+                                                                 pcbIndex++)
+       {
+        arrivalTime
+                 = sim.program.opArg2[ sim.program.procStartOp[ pcbIndex ] ];
+        if (arrivalTime > 0)
+           {
+            scheduleArrival(&sim.interrupts, createArrival(pcbIndex,
+                     arrivalTime, &sim.pcbArray[ pcbIndex ], &sim.interrupts));
+           }
+       }
+    initMemoryMgr(&sim.memory, configPtr->memAvailable, sim.program.numProcs,
+                         sim.pagedMode == True ? MEM_FIT_NONE_CODE
+                            : configPtr->memFitCode, configPtr->memCompaction);
+    if (sim.pagedMode == True)
+       {
+        initPagingMgr(&sim.pager, configPtr->memAvailable, configPtr->pageSize,
+                             configPtr->tlbEntries, configPtr->pageReplaceCode,
+                                                       sim.program.numProcs);
+       }
+    pthread_mutex_init(&sim.simLock, NULL);
 
-        // check for new process selected or start of existing process
-        if (compareString(nextjobs->opCodePtr->strArg1, "start") == STR_EQ)
-          {
-            // display new process selected
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                       " %s, OS: Process %d selected with %d ms remaining\n",
-                        timeStr, nextjobs->pid, (int)nextjobs->timeRemaining);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
+    // let idle cores sleep until an interrupt arrives
+    if (numCores > 1)
+       {
+        setInterruptWake(&sim.interrupts, &wakeCores, &sim.cores);
+       }
 
-            // display process state change
-            accessTimer(LAP_TIMER, timeStr);
-            sprintf(statusMessage,
-                         " %s, OS: Process %d set from READY to RUNNING\n\n",
-                                                              timeStr, nextjobs->pid);
-            updateDisplay(statusMessage, logToCode, fileHeadPtr);
+    // start extra cores on their own threads, stopping at first failure
+    // since remaining cores' queues are stolen by those running
+    coreArray = (SimCore*)malloc(sizeof(SimCore) * numCores);
+    for (numStarted = 1; numStarted < numCores; numStarted++)
+       {
+        coreArray[ numStarted ].coreId = numStarted;
+        coreArray[ numStarted ].simPtr = &sim;
+        if (pthread_create(&coreArray[ numStarted ].coreThread, NULL,
+                                      &runCore, &coreArray[ numStarted ]) != 0)
+           {
+            break;
            }
+       }
+
+    // start device service and raising later arrivals, then run first
+    // core on this thread and wait for the others
+    if (sim.deviceMode == True)
+       {
+        startDevices(&sim.devices);
+       }
+    startArrivals(&sim.interrupts);
+    coreArray[ 0 ].coreId = 0;
+    coreArray[ 0 ].simPtr = &sim;
+    runCore(&coreArray[ 0 ]);
+    for (coreId = 1; coreId < numStarted; coreId++)
+       {
+        pthread_join(coreArray[ coreId ].coreThread, NULL);
+       }
+    if (sim.deviceMode == True)
+       {
+        stopDevices(&sim.devices);
+       }
 
-         // set selected process to running
-        nextjobs->currState = RUNNING;
+    // display end of opeations
+    logEvent(&sim.simLog, EVT_SYS_STOP, 0, NULL, 0);
 
-        // return local pointer
-        return nextjobs;
+    // display paging totals, if paged
+    if (sim.pagedMode == True)
+       {
+        logEvent(&sim.simLog, EVT_TLB_HITS, 0, NULL, sim.pager.tlbHits);
+        logEvent(&sim.simLog, EVT_TLB_MISSES, 0, NULL, sim.pager.tlbMisses);
+        logEvent(&sim.simLog, EVT_PAGE_FAULTS, 0, NULL, sim.pager.pageFaults);
+        logEvent(&sim.simLog, EVT_PAGE_EVICTIONS, 0, NULL,
+                                                        sim.pager.evictions);
+        clearPagingMgr(&sim.pager);
+       }
 
-        }
+    // dislay end of sim
+    logEvent(&sim.simLog, EVT_SIM_END, 0, NULL, 0);
+
+    // report run totals
+    resultPtr->completed = True;
+    resultPtr->numProcs = sim.program.numProcs;
+    resultPtr->numOps = sim.program.numOps;
+    resultPtr->numCores = numCores;
+    resultPtr->simTime = accessClock(&sim.simClock, LAP_TIMER, timeStr);
+
+    // find scheduling metrics, displaying and saving them if configured
+    computeMetrics(&resultPtr->metrics, sim.pcbArray, sim.program.numProcs,
+                                                                  numCores);
+    if (configPtr->metricsDisplay == True)
+       {
+        logMetricsReport(&sim.simLog, &resultPtr->metrics, sim.pcbArray,
+                                                       sim.program.numProcs);
+        if (sim.memory.fitCode != MEM_FIT_NONE_CODE)
+           {
+            logMemoryReport(&sim.simLog, &sim.memory, resultPtr->simTime);
+           }
+        if (sim.deviceMode == True)
+           {
+            logDeviceReport(&sim.simLog, &sim.devices,
+                                             resultPtr->metrics.makespan);
+           }
+       }
+    if (getStringLength(configPtr->metricsFileName) > 0
+        && writeMetricsCsv(configPtr->metricsFileName, &resultPtr->metrics,
+                               sim.pcbArray, sim.program.numProcs) == False
+        && monitorPtr != NULL)
+       {
+        fprintf(monitorPtr, "Unable to write metrics file: %s\n",
+                                                configPtr->metricsFileName);
+       }
+
+    // write remaining output to files, if configured to do so
+    closeSimLog(&sim.simLog, configPtr);
 
-   return localPtr;
+    // free allocated memory
+    sim.opPool = destroyWorkerPool(sim.opPool);
+    sim.cpuPool = destroyWorkerPool(sim.cpuPool);
+    destroyInterruptQueue(&sim.interrupts);
+    if (sim.deviceMode == True)
+       {
+        clearDeviceSet(&sim.devices);
+       }
+    pthread_mutex_destroy(&sim.simLock);
+    free(coreArray);
+    clearCoreSet(&sim.cores);
+    clearMemoryMgr(&sim.memory);
+    clearProgram(&sim.program);
+    *programPtr = sim.program;
+    PROFILE_END(PROF_RUN_SIM);
+
+    // return successful run
+    return True;
    }
 
 /*
- * Function Name: initializePCBs
- * Algorithm: recursively builds a linked list of PCBs using given data,
- *            including a calculation of time remaining
- * Precondition: given a pointer to a PCB node to initialize, a pointer to the
- *               start of its process in metadata, a pointer to config data,
- *               and its pid
- * Postcondition: PCB data structure created with appropriate data and a node
- *                for each process
- * Exceptions: none
- * Note: none
+ * Function Name: runSimulation
+ * Algorithm: builds the program from the meta data list, then runs it
+ * Precondition: given config data, meta data head pointer, monitor stream
+ *               (NULL for none), and result storage
+ * Postcondition: simulation is provided, file output is provided as
+ *                configured, result filled in; True returned unless the
+ *                meta data could not be run
+ * Exceptions: process with no app end is reported and not run
+ * Notes: meta data list is not modified
  */
-PCB *initializePCBs(PCB *localPtr, OpCodeType *localMdPtr,
-                                        ConfigDataType *configPtr, int currPid)
+Boolean runSimulation(ConfigDataType *configPtr, OpCodeType *metaDataMstrPtr,
+                                      FILE *monitorPtr, SimResult *resultPtr)
    {
-    //initialize variables
-    int procTotal = 0, ioTotal = 0, totalTime = 0;
+    // initialize function/variables
+    SimProgram program;
+    Boolean loaded;
 
-    // temp iter
-    OpCodeType *iterator = localMdPtr;
+    // load program into flat op arrays
+    PROFILE_BEGIN(PROF_LOAD_PROGRAM);
+    loaded = buildProgram(&program, metaDataMstrPtr);
+    PROFILE_END(PROF_LOAD_PROGRAM);
 
-    // check for not at end of op codes
-    if (compareString(localMdPtr->command, "sys") != STR_EQ &&
-        compareString(localMdPtr->strArg1, "end") != STR_EQ)
+    // check for process left open
+    if (loaded == False)
        {
-        // initialize PCB values
-        localPtr = (PCB*)malloc(sizeof(PCB));
-        localPtr->pid = currPid;
-        localPtr->currState = NEW;
-        localPtr->timeRemaining = 0;
-        localPtr->opCodePtr = localMdPtr;
-        localPtr->nextNode = NULL;
-
-
-
-        // loop while not at end of op
-        while (compareString(iterator->strArg1, "end") != STR_EQ)
+        resultPtr->completed = False;
+        if (monitorPtr != NULL)
            {
-            // check for io op
-            if (compareString(iterator->inOutArg, "in") == STR_EQ ||
-                compareString(iterator->inOutArg, "out") == STR_EQ)
-               {
-                // add cycles to total io cycles
-                ioTotal += iterator->intArg2;
-               }
+            fprintf(monitorPtr, "Simulator Run");
+            fprintf(monitorPtr, "\n-------------\n\n");
+            fprintf(monitorPtr, "Error: process in meta data has no app end,"
+                                                          " run aborted\n");
+           }
+        clearProgram(&program);
+        return False;
+       }
 
-            // otherwise, check for cpu op
-            else if (compareString(iterator->strArg1, "process") == STR_EQ)
-               {
-                // add cycles to total cpu cycles
-                procTotal += iterator->intArg2;
-               }
+    // run program
+    return runProgram(configPtr, &program, monitorPtr, resultPtr);
+   }
 
-            // iterate to next node
-            iterator = iterator->nextNode;
-           }
+/*
+ * Function Name: simComplete
+ * Algorithm: determines whether the simulator is complete by checking the
+ *            live count of processes not yet in the EXIT state
+ * Precondition: given core set holding active process count
+ * Postcondition: boolean result of test returned
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean simComplete(CoreSet *coreSetPtr)
+   {
+    return coreSetPtr->activeCount == 0;
+   }
 
-        // calculate remaining time
-        totalTime += ioTotal * configPtr->ioCycleRate;
-        totalTime += procTotal * configPtr->procCycleRate;
-        localPtr->timeRemaining = totalTime;
+/*
+ * Function Name: setLevel
+ * Algorithm: moves the process to the given priority level, clamped to
+ *            the levels in use, with a full quantum, displaying the move
+ * Precondition: given process, simulator context in multilevel mode, and
+ *               new level, 0 highest
+ * Postcondition: process level and quantum set
+ * Exceptions: none
+ * Notes: a move past the top or bottom level only restarts the quantum
+ */
+void setLevel(PCB *pcbPtr, SimContext *simPtr, int level)
+   {
+    // initialize variables
+    int oldLevel = pcbPtr->schedLevel;
 
-        // increment pid and recursively add next PCB
-        currPid++;
-        localPtr->nextNode = initializePCBs(localPtr->nextNode,
-                                     iterator->nextNode, configPtr, currPid);
+    // clamp level to those in use
+    if (level < 0)
+       {
+        level = 0;
+       }
+    else if (level >= simPtr->numLevels)
+       {
+        level = simPtr->numLevels - 1;
        }
 
-    // return local pointer
-    return localPtr;
+    // set level with full quantum
+    pcbPtr->schedLevel = level;
+    pcbPtr->quantumUsed = 0;
+
+    // display move, if any
+    if (level > oldLevel)
+       {
+        logEvent(&simPtr->simLog, EVT_LEVEL_LOWERED, pcbPtr->pid, NULL,
+                                                                      level);
+       }
+    else if (level < oldLevel)
+       {
+        logEvent(&simPtr->simLog, EVT_LEVEL_RAISED, pcbPtr->pid, NULL,
+                                                                      level);
+       }
    }
 
 /*
- * Function Name: outputToFile
- * Algorithm: iterates through file linked list, printing each element to the
- *            file as it goes
- * Precondition: given pointer to file linked list and name of file to output
- *               to
- * Postcondition: simulator output is dumped to file
+ * Function Name: setLevelQuanta
+ * Algorithm: sets the number of priority levels and each level's quantum,
+ *            the configured quantum at the top level and each lower level
+ *            the configured scale times the one above it, and the first
+ *            aging time
+ * Precondition: given simulator context with config and clock mode set
+ * Postcondition: level fields set; a single level unless in multilevel
+ *                mode
  * Exceptions: none
- * Note: none
+ * Notes: unset level count and scale take their defaults; quanta stop
+ *        growing rather than overflow
  */
-void outputToFile(FileNode *iterator, char *fileName)
+void setLevelQuanta(SimContext *simPtr)
    {
-    // open file for writing
-    FILE *filePtr = fopen(fileName, "w");
+    // initialize variables
+    ConfigDataType *configPtr = simPtr->configPtr;
+    int scale = configPtr->mlfqQuantumScale;
+    int level;
+
+    // set single level unless in multilevel mode
+    simPtr->numLevels = 1;
+    simPtr->levelQuanta[ 0 ] = configPtr->quantumCycles;
+    simPtr->agingEpoch = 0;
+    simPtr->nextAgingTime = configPtr->mlfqAgingTime / MS_PER_SEC;
+    if (simPtr->levelMode == False)
+       {
+        return;
+       }
 
-    // loop across linked list, printing each string to file
-    while (iterator != NULL)
+    // find level count, clamped to ready queue limit
+    simPtr->numLevels = configPtr->mlfqLevels;
+    if (simPtr->numLevels < 1)
+       {
+        simPtr->numLevels = MLFQ_DEFAULT_LEVELS;
+       }
+    else if (simPtr->numLevels > MAX_READY_LEVELS)
        {
-        fputs(iterator->printStr, filePtr);
-        iterator = iterator->nextNode;
+        simPtr->numLevels = MAX_READY_LEVELS;
+       }
+    if (scale < 1)
+       {
+        scale = MLFQ_DEFAULT_SCALE;
        }
 
-    // close file
-    fclose(filePtr);
+    // scale each level's quantum from the one above
+    for (level = 1; level < simPtr->numLevels; level++)
+       {
+        simPtr->levelQuanta[ level ] = simPtr->levelQuanta[ level - 1 ];
+        if (simPtr->levelQuanta[ level ] <= INT_MAX / scale)
+           {
+            simPtr->levelQuanta[ level ] *= scale;
+           }
+       }
    }
 
 /*
- * Function Name: isComplete
- * Algorithm: determines whether the simulator is complete by checking if all
- *            processes have finished execution
- * Precondition: given head pointer to PCB data strucutre
- * Postcondition: boolean result of tests returned
+ * Function Name: setReady
+ * Algorithm: sets the process to ready and queues it, in sort order, on
+ *            the given core; the sort key is arrival time, then list
+ *            order, for FCFS, the predicted remainder of the current cpu
+ *            burst for SJF-N and SRTF-P with burst prediction on, the
+ *            priority level for MLFQ-P, and time remaining otherwise
+ * Precondition: given PCB, simulator context, and core id; simulator lock
+ *               held
+ * Postcondition: process is in READY state on the core's ready queue
  * Exceptions: none
- * Notes: none
+ * Notes: key is ignored by FIFO ready queues
  */
-Boolean simComplete(PCB *localPtr)
+void setReady(PCB *pcbPtr, SimContext *simPtr, int coreId)
    {
-    // initialize variable
-    Boolean complete = True;
+    // initialize variables
+    SimProgram *progPtr = &simPtr->program;
+    double sortKey = pcbPtr->timeRemaining;
 
-    // loop while not at end of PCB nodes
-    while (localPtr != NULL)
+    // check for first come order, by arrival ms and then process id
+    if (simPtr->configPtr->cpuSchedCode == CPU_SCHED_FCFS_N_CODE
+              || simPtr->configPtr->cpuSchedCode == CPU_SCHED_FCFS_P_CODE)
        {
-        // check for current process not in exit state
-        if (localPtr->currState != EXIT)
+        sortKey = (double)progPtr->opArg2[ progPtr->procStartOp[
+                   pcbPtr->pid ] ] * progPtr->numProcs + pcbPtr->pid;
+       }
+
+    // otherwise, check for multilevel queue, raising process first if
+    // aging has run since its level was set
+    else if (simPtr->levelMode == True)
+       {
+        refreshLevel(pcbPtr, simPtr);
+        sortKey = pcbPtr->schedLevel;
+       }
+
+    // otherwise, check for order by predicted burst, less any part of it
+    // already run before a preemption
+    else if (usesBurstPrediction(simPtr->configPtr) == True)
+       {
+        sortKey = pcbPtr->predictedBurst - pcbPtr->burstTime;
+        if (sortKey < 0.0)
            {
-            // unset complete flag
-            complete = False;
+            sortKey = 0.0;
            }
-
-        // iterate to next PCB
-        localPtr = localPtr->nextNode;
        }
 
-    // return boolean result of tests
-    return complete;
+    // set state, noting when it became ready, and queue process
+    pcbPtr->currState = READY;
+    pcbPtr->stateTime = readClock(&simPtr->simClock);
+    pushCoreReady(&simPtr->cores, coreId, pcbPtr, sortKey);
    }
 
 /*
@@ -656,139 +1330,53 @@ Boolean simComplete(PCB *localPtr)
  * Algorithm: thread operation that simulates an I/O or cpu op by running a
  *            timer for a specified time
  * Precondtion: given running time of op code
- * Postcondition: thread exits after timer is run
+ * Postcondition: function returns after timer is run
  * Exeptions: none
- * Notes: none
+ * Notes: runs as a worker pool job, so it must return rather than
+ *        calling pthread_exit
  */
 void *threadOp(void *time)
    {
     // make integer pointer for time
     int *timeVal = time;
 
-    // run timer for specified time and exit
+    // run timer for specified time and return
     runTimer(*timeVal);
-    pthread_exit(NULL);
+    return NULL;
    }
 
 /*
- * Function Name: updateDisplay
- * Algorithm: updates simulator display by outputting status to console,
- *            storing it in a linked list, or both, depending on given
- *            flag
- * Precondition: given status message as a c-style string, display flag, and
- *               head pointer to file linked list
- * Postcondition: simulator output is printed and/or updated as specified
- * Exeptions: none
- * Notes: uses addFileNode to conduct linked list operations
+ * Function Name: usesBurstPrediction
+ * Algorithm: checks for a shortest-job strategy with a nonzero averaging
+ *            weight configured
+ * Precondition: given config data
+ * Postcondition: True returned when SJF-N or SRTF-P should order by
+ *                predicted burst
+ * Exceptions: none
+ * Notes: with a zero weight, shortest-job strategies order by the exact
+ *        time remaining
  */
-void updateDisplay(char *statusMessage, int logFlag, FileNode *headPtr)
+Boolean usesBurstPrediction(ConfigDataType *configPtr)
    {
-    // output to monitor, if configured
-    if (logFlag == LOGTO_MONITOR_CODE || logFlag == LOGTO_BOTH_CODE)
-       {
-        printf(statusMessage);
-       }
-
-    // update file output, if configured
-    if (logFlag == LOGTO_FILE_CODE || logFlag == LOGTO_BOTH_CODE)
-       {
-        headPtr = addFileNode(headPtr, statusMessage);
-       }
+    return configPtr->burstAlpha > 0.0
+        && (configPtr->cpuSchedCode == CPU_SCHED_SJF_N_CODE
+            || configPtr->cpuSchedCode == CPU_SCHED_SRTF_P_CODE);
    }
 
 /*
- * Function Name: addMem
- * Algorithm: create linked list of memory coordinates to use
- * Precondtion: given start and end coordinates
- * Postcondition: gives a pointer back
- */
-MMU *addMem( MMU *head, int first, int second,  ConfigDataType *configPtr )
-  {
-    MMU *newMMU;
-    // special case with the header being null
-    if ( head == NULL )
-      {
-        newMMU = (MMU*)malloc(sizeof(MMU));
-        newMMU->start = first;
-        newMMU->end = first + second;
-        newMMU->nextNode = NULL;
-        newMMU->mmuResult = True;
-        if ( newMMU->end > configPtr->memAvailable )
-          {
-            newMMU->mmuResult = False;
-            head = newMMU;
-            return newMMU;
-          }
-        head = newMMU;
-        return head;
-        //printf("%d, %d\n", tempMem->start, tempMem->end);
-      }
-
-    // initialization
-    newMMU = (MMU*)malloc(sizeof(MMU));
-    newMMU->start = first;
-    newMMU->end = first + second;
-    newMMU->nextNode = NULL;
-    newMMU->mmuResult = False;
-    MMU *tempMem = head;
-
-    // check if enough memory available to allocate
-    if ( newMMU->end > configPtr->memAvailable )
-      {
-        newMMU->mmuResult = False;
-        return newMMU;
-      }
-
-    // loops through every node and checks for overlaps
-    while ( tempMem != NULL && tempMem->mmuResult == True )
-      {
-        if ( (newMMU->start > tempMem->start && newMMU->end > tempMem->end
-                                            && newMMU->start < tempMem->end) )
-          {
-            newMMU->mmuResult = False;
-            return newMMU;
-          }
-        else if ( (newMMU->start < tempMem->start && newMMU->end < tempMem->end ) )
-          {
-            newMMU->mmuResult = False;
-            return newMMU;
-          }
-        else if ( (newMMU->start > tempMem->start && newMMU->end < tempMem->end) )
-          {
-            newMMU->mmuResult = False;
-            return newMMU;
-          }
-        else if ( (newMMU->start < tempMem->start && newMMU->end > tempMem->end) )
-          {
-            newMMU->mmuResult = False;
-            return newMMU;
-          }
-        tempMem = tempMem->nextNode;
-      }
-    // return a true flagged node for success
-    tempMem->nextNode = newMMU;
-    newMMU->mmuResult = True;
-    return newMMU;
-  }
-
-
-/*
- * Function Name: memAccess
- * Algorithm: looks at all the nodes and looks to see if first and send fit inbetween
- *              the current nodes start and end
- * Precondtion: a header, and 2 values to check
- * Postcondition: a boolean value of the result
+ * Function Name: usesReadyHeap
+ * Algorithm: checks scheduling code for a strategy that selects by key
+ *            rather than by order of becoming ready
+ * Precondition: given scheduling code
+ * Postcondition: True returned for SJF-N, SRTF-P, FCFS-N, and FCFS-P
+ * Exceptions: none
+ * Notes: FCFS keys on process id, so ready processes are taken in their
+ *        original list order and a preempted process keeps its place
  */
-Boolean memAccess( MMU *memHead, int first, int second )
-  {
-    int end = first + second;
-    while ( memHead != NULL )
-      {
-        if (first > memHead->start && end < memHead->end )
-          {
-            return True;
-          }
-        memHead = memHead->nextNode;
-      }
-    return False;
-  }
+Boolean usesReadyHeap(int schedCode)
+   {
+    return schedCode == CPU_SCHED_SJF_N_CODE
+        || schedCode == CPU_SCHED_SRTF_P_CODE
+        || schedCode == CPU_SCHED_FCFS_N_CODE
+        || schedCode == CPU_SCHED_FCFS_P_CODE;
+   }
@@ -0,0 +1,250 @@
+// header files
+#include "TraceEvents.h"
+
+/*
+ * Function Name: formatEvent
+ * Algorithm: builds the display line for an event code from its time
+ *            string and arguments
+ * Precondition: given output string storage, time string, event code, pid,
+ *               device name for I/O events, and event argument (ms
+ *               remaining for selection, nonzero for input I/O)
+ * Postcondition: display line stored in output string; empty for codes
+ *                that have no display line
+ * Exceptions: none
+ * Notes: single source of the simulator's text format, shared by the live
+ *        log and the offline trace renderer
+ */
+void formatEvent(char *outputStr, char *timeStr, int eventCode, int pid,
+                                            char *deviceName, int64_t eventArg)
+   {
+    // initialize function/variables
+    char *ioType = eventArg != 0 ? "input" : "output";
+
+    // select line for event code
+    switch (eventCode)
+       {
+        case EVT_SIM_START:
+           sprintf(outputStr, " %s, OS: Simulator Start\n", timeStr);
+           break;
+
+        case EVT_NEW_TO_READY:
+           sprintf(outputStr,
+                 " %s, OS: Process %d set to READY state from NEW state,\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_PROC_SELECTED:
+           sprintf(outputStr, " %s, OS: Process %d selected with %" PRId64
+                               " ms remaining\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_READY_TO_RUNNING:
+           sprintf(outputStr,
+                  " %s, OS: Process %d set from READY to RUNNING\n\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_CPU_IDLE:
+           sprintf(outputStr,
+                " %s, OS: CPU idle, all active processes blocked\n", timeStr);
+           break;
+
+        case EVT_CPU_IDLE_END:
+           sprintf(outputStr, " %s, OS: CPU interrupt, end idle\n", timeStr);
+           break;
+
+        case EVT_IO_START:
+           sprintf(outputStr, " %s, Process: %d, %s %s operation start\n",
+                                         timeStr, pid, deviceName, ioType);
+           break;
+
+        case EVT_IO_BLOCKED:
+           sprintf(outputStr, " %s, OS: Process %d blocked for %s operation\n",
+                                                       timeStr, pid, ioType);
+           break;
+
+        case EVT_RUNNING_TO_BLOCKED:
+           sprintf(outputStr,
+                  " %s, OS: Process %d set from RUNNING to BLOCKED\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_IO_INTERRUPT:
+           sprintf(outputStr,
+                  " %s, OS: Interrupted by process %d, %s %s operation\n",
+                                         timeStr, pid, deviceName, ioType);
+           break;
+
+        case EVT_IO_END:
+           sprintf(outputStr, " %s, Process: %d, %s %s operation end\n",
+                                         timeStr, pid, deviceName, ioType);
+           break;
+
+        case EVT_BLOCKED_TO_READY:
+           sprintf(outputStr,
+                  " %s, OS: Process %d set from BLOCKED to READY\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_CPU_START:
+           sprintf(outputStr,
+                  " %s, Process: %d, cpu process operation start\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_CPU_END:
+           sprintf(outputStr,
+                  " %s, Process: %d, cpu process operation end\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ALLOC_START:
+           sprintf(outputStr,
+                  " %s, Process: %d, attempting mem allocate request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ALLOC_SUCCESS:
+           sprintf(outputStr,
+                  " %s, Process: %d, successful mem allocate request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ALLOC_FAIL:
+           sprintf(outputStr,
+                  " %s, Process: %d, failed mem allocate request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ACCESS_START:
+           sprintf(outputStr,
+                  " %s, Process: %d, attempting mem access request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ACCESS_SUCCESS:
+           sprintf(outputStr,
+                  " %s, Process: %d, successful mem access request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_MEM_ACCESS_FAIL:
+           sprintf(outputStr,
+                  " %s, Process: %d, failed mem access request\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_SEG_FAULT:
+           sprintf(outputStr,
+                  " %s, Process: %d, experiences segmentation fault\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_PROC_END:
+           sprintf(outputStr, "\n %s, OS: Process %d ended\n", timeStr, pid);
+           break;
+
+        case EVT_PROC_EXIT:
+           sprintf(outputStr, " %s, OS: Process %d set to EXIT\n",
+                                                               timeStr, pid);
+           break;
+
+        case EVT_SYS_STOP:
+           sprintf(outputStr, " %s, OS: System stop\n", timeStr);
+           break;
+
+        case EVT_SIM_END:
+           sprintf(outputStr, " %s, OS: Simulation end\n", timeStr);
+           break;
+
+        case EVT_QUANTUM_TIMEOUT:
+           sprintf(outputStr, " %s, OS: Process %d quantum time out, "
+                          "cpu process operation end\n", timeStr, pid);
+           break;
+
+        case EVT_CPU_PREEMPTED:
+           sprintf(outputStr, " %s, OS: Process %d interrupted, "
+                          "cpu process operation end\n", timeStr, pid);
+           break;
+
+        case EVT_RUNNING_TO_READY:
+           sprintf(outputStr, " %s, OS: Process %d set from RUNNING "
+                                          "to READY\n", timeStr, pid);
+           break;
+
+        case EVT_PAGE_FAULT:
+           sprintf(outputStr, " %s, Process: %d, page faults serviced: %"
+                                   PRId64 "\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_TLB_HITS:
+           sprintf(outputStr, " %s, OS: TLB hits: %" PRId64 "\n",
+                                                          timeStr, eventArg);
+           break;
+
+        case EVT_TLB_MISSES:
+           sprintf(outputStr, " %s, OS: TLB misses: %" PRId64 "\n",
+                                                          timeStr, eventArg);
+           break;
+
+        case EVT_PAGE_FAULTS:
+           sprintf(outputStr, " %s, OS: Page faults: %" PRId64 "\n",
+                                                          timeStr, eventArg);
+           break;
+
+        case EVT_PAGE_EVICTIONS:
+           sprintf(outputStr, " %s, OS: Pages evicted: %" PRId64 "\n",
+                                                          timeStr, eventArg);
+           break;
+
+        case EVT_CORE_DISPATCH:
+           sprintf(outputStr, " %s, OS: Process %d dispatched on core %"
+                                   PRId64 "\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_WORK_STOLEN:
+           sprintf(outputStr, " %s, OS: Process %d stolen by core %"
+                                   PRId64 "\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_LEVEL_LOWERED:
+           sprintf(outputStr, " %s, OS: Process %d lowered to priority "
+                                "level %" PRId64 "\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_LEVEL_RAISED:
+           sprintf(outputStr, " %s, OS: Process %d raised to priority "
+                                "level %" PRId64 "\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_LEVELS_AGED:
+           sprintf(outputStr, " %s, OS: Aging raised %" PRId64 " ready "
+                     "processes to top priority level\n", timeStr, eventArg);
+           break;
+
+        case EVT_IO_QUEUED:
+           sprintf(outputStr, " %s, OS: Process %d queued for %s behind %"
+                PRId64 " request(s)\n", timeStr, pid, deviceName, eventArg);
+           break;
+
+        case EVT_MEM_COMPACTED:
+           sprintf(outputStr, " %s, OS: Memory compacted for process %d, "
+                   "%" PRId64 " bytes moved\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_MEM_FRAGMENTED:
+           sprintf(outputStr, " %s, OS: Process %d needs %" PRId64 " bytes, "
+                  "free memory too fragmented\n", timeStr, pid, eventArg);
+           break;
+
+        case EVT_IO_WORKERS_CAPPED:
+           sprintf(outputStr, " %s, OS: I/O workers capped at %" PRId64
+                    ", further blocked processes wait for a free worker\n",
+                                                          timeStr, eventArg);
+           break;
+
+        default:
+           outputStr[ 0 ] = NULL_CHAR;
+           break;
+       }
+   }
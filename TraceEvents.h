@@ -0,0 +1,91 @@
+// Preprocessor directive
+#ifndef TRACE_EVENTS_H
+#define TRACE_EVENTS_H
+
+// header files
+#include <stdio.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include "StringUtils.h"
+#include "SimClock.h"
+
+// global constants
+#define TRACE_MAGIC "OSSIMTRC"
+#define TRACE_MAGIC_LEN 8
+#define TRACE_VERSION 2
+#define TRACE_NO_DEVICE -1
+#define TRACE_RECORD_SIZE 24
+#define MAX_EVENT_LINE_LEN 256
+#define TRACE_TIME_FORMAT VIRTUAL_TIME_FORMAT
+
+// every line the simulator can log; the order is part of the trace format,
+// so new codes are only ever added at the end
+typedef enum
+   {
+    EVT_SIM_START,
+    EVT_NEW_TO_READY,
+    EVT_PROC_SELECTED,
+    EVT_READY_TO_RUNNING,
+    EVT_CPU_IDLE,
+    EVT_CPU_IDLE_END,
+    EVT_IO_START,
+    EVT_IO_BLOCKED,
+    EVT_RUNNING_TO_BLOCKED,
+    EVT_IO_INTERRUPT,
+    EVT_IO_END,
+    EVT_BLOCKED_TO_READY,
+    EVT_CPU_START,
+    EVT_CPU_END,
+    EVT_MEM_ALLOC_START,
+    EVT_MEM_ALLOC_SUCCESS,
+    EVT_MEM_ALLOC_FAIL,
+    EVT_MEM_ACCESS_START,
+    EVT_MEM_ACCESS_SUCCESS,
+    EVT_MEM_ACCESS_FAIL,
+    EVT_SEG_FAULT,
+    EVT_PROC_END,
+    EVT_PROC_EXIT,
+    EVT_SYS_STOP,
+    EVT_SIM_END,
+    EVT_DEVICE_NAME,
+    EVT_QUANTUM_TIMEOUT,
+    EVT_CPU_PREEMPTED,
+    EVT_RUNNING_TO_READY,
+    EVT_PAGE_FAULT,
+    EVT_TLB_HITS,
+    EVT_TLB_MISSES,
+    EVT_PAGE_FAULTS,
+    EVT_PAGE_EVICTIONS,
+    EVT_CORE_DISPATCH,
+    EVT_WORK_STOLEN,
+    EVT_LEVEL_LOWERED,
+    EVT_LEVEL_RAISED,
+    EVT_LEVELS_AGED,
+    EVT_IO_QUEUED,
+    EVT_MEM_COMPACTED,
+    EVT_MEM_FRAGMENTED,
+    EVT_IO_WORKERS_CAPPED
+   } TraceEventCode;
+
+// fixed-size binary trace record in host byte order; an EVT_DEVICE_NAME
+// record is followed by eventArg bytes of device name, defining deviceId
+// for later records; the argument is 64 bits on every host so run totals
+// are not truncated, which also leaves the record with no padding bytes
+typedef struct TraceRecord
+   {
+    double eventTime;
+    int pid;
+    short eventCode;
+    short deviceId;
+    int64_t eventArg;
+   } TraceRecord;
+
+// record layout check, as the size is part of the trace format
+_Static_assert(sizeof(TraceRecord) == TRACE_RECORD_SIZE,
+                                       "trace record must be 24 bytes");
+
+// function prototypes
+void formatEvent(char *outputStr, char *timeStr, int eventCode, int pid,
+                                           char *deviceName, int64_t eventArg);
+
+#endif // TRACE_EVENTS_H
@@ -0,0 +1,221 @@
+// header files
+#include "WorkerPool.h"
+
+/*
+ * Function Name: createWorkerPool
+ * Algorithm: allocates the pool, initializes its queue and synchronization
+ *            objects, then starts the requested number of worker threads
+ * Precondition: given number of worker threads, at least one
+ * Postcondition: running pool returned, or NULL if threads could not start
+ * Exceptions: none
+ * Notes: threads live until destroyWorkerPool is called
+ */
+WorkerPool *createWorkerPool(int numThreads)
+   {
+    // initialize function/variables
+    WorkerPool *pool;
+    int index;
+
+    // ensure at least one worker exists
+    if (numThreads < 1)
+       {
+        numThreads = 1;
+       }
+
+    // allocate and initialize pool data
+    pool = (WorkerPool*)malloc(sizeof(WorkerPool));
+    pool->threads = (pthread_t*)malloc(sizeof(pthread_t) * numThreads);
+    pool->numThreads = 0;
+    pool->headPtr = NULL;
+    pool->tailPtr = NULL;
+    pool->shutdown = False;
+    pthread_mutex_init(&pool->poolLock, NULL);
+    pthread_cond_init(&pool->jobAvailable, NULL);
+    pthread_cond_init(&pool->jobComplete, NULL);
+
+    // start worker threads
+    for (index = 0; index < numThreads; index++)
+       {
+        if (pthread_create(&pool->threads[index], NULL,
+                                                 &workerLoop, pool) != 0)
+           {
+            // release whatever was started and report failure
+            return destroyWorkerPool(pool);
+           }
+
+        pool->numThreads++;
+       }
+
+    // return running pool
+    return pool;
+   }
+
+/*
+ * Function Name: destroyWorkerPool
+ * Algorithm: flags the pool for shutdown, wakes and joins every worker,
+ *            then returns all pool memory to OS
+ * Precondition: given pool pointer, may be NULL
+ * Postcondition: worker threads joined, memory released, NULL returned
+ * Exceptions: none
+ * Notes: jobs still queued at shutdown are run before workers exit
+ */
+WorkerPool *destroyWorkerPool(WorkerPool *pool)
+   {
+    // initialize function/variables
+    int index;
+
+    // check for pool not null
+    if (pool != NULL)
+       {
+        // signal shutdown to all workers
+        pthread_mutex_lock(&pool->poolLock);
+        pool->shutdown = True;
+        pthread_cond_broadcast(&pool->jobAvailable);
+        pthread_mutex_unlock(&pool->poolLock);
+
+        // wait for each worker to finish
+        for (index = 0; index < pool->numThreads; index++)
+           {
+            pthread_join(pool->threads[index], NULL);
+           }
+
+        // release memory to OS
+        pthread_cond_destroy(&pool->jobComplete);
+        pthread_cond_destroy(&pool->jobAvailable);
+        pthread_mutex_destroy(&pool->poolLock);
+        free(pool->threads);
+        free(pool);
+       }
+
+    // return null to calling function
+    return NULL;
+   }
+
+/*
+ * Function Name: runPoolJob
+ * Algorithm: submits a job built on the caller's stack and blocks until a
+ *            worker has completed it
+ * Precondition: given running pool, job function, and its argument
+ * Postcondition: job function has run to completion on a worker thread
+ * Exceptions: none
+ * Notes: drop-in replacement for a pthread_create/pthread_join pair
+ */
+void runPoolJob(WorkerPool *pool, JobFunction jobFunc, void *jobArg)
+   {
+    // initialize function/variables
+    WorkerJob job;
+
+    // hand job to pool and wait for completion
+    submitJob(pool, &job, jobFunc, jobArg);
+    waitForJob(pool, &job);
+   }
+
+/*
+ * Function Name: submitJob
+ * Algorithm: fills in the given job and appends it to the tail of the pool
+ *            queue, waking one idle worker
+ * Precondition: given running pool, caller-owned job storage, job function,
+ *               and its argument
+ * Postcondition: job queued for execution
+ * Exceptions: none
+ * Notes: job storage must remain valid until waitForJob returns
+ */
+void submitJob(WorkerPool *pool, WorkerJob *job,
+                                          JobFunction jobFunc, void *jobArg)
+   {
+    // set job data
+    job->jobFunc = jobFunc;
+    job->jobArg = jobArg;
+    job->jobDone = False;
+    job->nextNode = NULL;
+
+    // append to queue tail
+    pthread_mutex_lock(&pool->poolLock);
+    if (pool->tailPtr == NULL)
+       {
+        pool->headPtr = job;
+       }
+    else
+       {
+        pool->tailPtr->nextNode = job;
+       }
+    pool->tailPtr = job;
+
+    // wake one worker
+    pthread_cond_signal(&pool->jobAvailable);
+    pthread_mutex_unlock(&pool->poolLock);
+   }
+
+/*
+ * Function Name: waitForJob
+ * Algorithm: blocks on the pool completion condition until the given job
+ *            has been flagged done by a worker
+ * Precondition: given pool and a previously submitted job
+ * Postcondition: job is complete
+ * Exceptions: none
+ * Notes: none
+ */
+void waitForJob(WorkerPool *pool, WorkerJob *job)
+   {
+    // wait for completion flag
+    pthread_mutex_lock(&pool->poolLock);
+    while (job->jobDone == False)
+       {
+        pthread_cond_wait(&pool->jobComplete, &pool->poolLock);
+       }
+    pthread_mutex_unlock(&pool->poolLock);
+   }
+
+/*
+ * Function Name: workerLoop
+ * Algorithm: worker thread body; repeatedly pops the queue head, runs it,
+ *            and flags it complete until shutdown with an empty queue
+ * Precondition: given pointer to owning pool
+ * Postcondition: thread exits on shutdown
+ * Exceptions: none
+ * Notes: none
+ */
+void *workerLoop(void *poolPtr)
+   {
+    // initialize function/variables
+    WorkerPool *pool = poolPtr;
+    WorkerJob *job;
+
+    // loop until shutdown
+    pthread_mutex_lock(&pool->poolLock);
+    while (True)
+       {
+        // wait for a job or shutdown
+        while (pool->headPtr == NULL && pool->shutdown == False)
+           {
+            pthread_cond_wait(&pool->jobAvailable, &pool->poolLock);
+           }
+
+        // check for shutdown with nothing left to run
+        if (pool->headPtr == NULL)
+           {
+            break;
+           }
+
+        // pop job from queue head
+        job = pool->headPtr;
+        pool->headPtr = job->nextNode;
+        if (pool->headPtr == NULL)
+           {
+            pool->tailPtr = NULL;
+           }
+
+        // run job outside of lock
+        pthread_mutex_unlock(&pool->poolLock);
+        job->jobFunc(job->jobArg);
+        pthread_mutex_lock(&pool->poolLock);
+
+        // flag completion and notify waiters
+        job->jobDone = True;
+        pthread_cond_broadcast(&pool->jobComplete);
+       }
+    pthread_mutex_unlock(&pool->poolLock);
+
+    // exit thread
+    return NULL;
+   }
@@ -0,0 +1,48 @@
+// Preprocessor directive
+#ifndef WORKER_POOL_H
+#define WORKER_POOL_H
+
+// header files
+#include <stdlib.h>
+#include <pthread.h>
+#include "StringUtils.h"
+
+// global constants
+#define DEFAULT_POOL_THREADS 2
+
+// job function signature, matches pthread start routines such as threadOp
+typedef void *(*JobFunction)(void *);
+
+// single unit of work handed to the pool; owned by the submitting caller
+// so that submitting a job never allocates
+typedef struct WorkerJob
+   {
+    JobFunction jobFunc;
+    void *jobArg;
+    Boolean jobDone;
+    struct WorkerJob *nextNode;
+   } WorkerJob;
+
+// long-lived set of worker threads sharing one FIFO job queue
+typedef struct WorkerPool
+   {
+    pthread_t *threads;
+    int numThreads;
+    WorkerJob *headPtr;
+    WorkerJob *tailPtr;
+    pthread_mutex_t poolLock;
+    pthread_cond_t jobAvailable;
+    pthread_cond_t jobComplete;
+    Boolean shutdown;
+   } WorkerPool;
+
+// function prototypes
+WorkerPool *createWorkerPool(int numThreads);
+WorkerPool *destroyWorkerPool(WorkerPool *pool);
+void runPoolJob(WorkerPool *pool, JobFunction jobFunc, void *jobArg);
+void submitJob(WorkerPool *pool, WorkerJob *job,
+                                         JobFunction jobFunc, void *jobArg);
+void waitForJob(WorkerPool *pool, WorkerJob *job);
+void *workerLoop(void *poolPtr);
+
+#endif // WORKER_POOL_H
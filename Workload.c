@@ -0,0 +1,330 @@
+// header files
+#include "Workload.h"
+
+// device names drawn for generated I/O ops
+static const char *inDevices[ NUM_IN_DEVICES ] =
+   {
+    "hard drive",
+    "keyboard",
+    "usb"
+   };
+static const char *outDevices[ NUM_OUT_DEVICES ] =
+   {
+    "monitor",
+    "hard drive",
+    "usb"
+   };
+
+/*
+ * Function Name: drawInterarrival
+ * Algorithm: draws an exponentially distributed gap by inverting the
+ *            distribution at a uniform draw in (0, 1)
+ * Precondition: given seed storage and arrival rate in processes per
+ *               second, greater than zero
+ * Postcondition: gap in ms returned, seed advanced
+ * Exceptions: none
+ * Notes: exponential gaps make arrivals a Poisson stream at the rate
+ */
+double drawInterarrival(unsigned int *seedPtr, double arrivalRate)
+   {
+    // initialize function/variables
+    double uniform = (rand_r(seedPtr) + 1.0) / (RAND_MAX + 2.0);
+
+    // return gap in ms
+    return -log(uniform) / arrivalRate * WORK_MS_PER_SEC;
+   }
+
+/*
+ * Function Name: drawRange
+ * Algorithm: draws a pseudo-random value from the caller's seed
+ * Precondition: given seed storage and inclusive range, low <= high
+ * Postcondition: value in range returned, seed advanced
+ * Exceptions: none
+ * Notes: reentrant, so the same seed always gives the same workload
+ */
+int drawRange(unsigned int *seedPtr, int low, int high)
+   {
+    return low + rand_r(seedPtr) % (high - low + 1);
+   }
+
+/*
+ * Function Name: initWorkloadSpec
+ * Algorithm: sets every field to its default
+ * Precondition: given spec storage
+ * Postcondition: spec describes the default workload, an even op mix
+ * Exceptions: none
+ * Notes: none
+ */
+void initWorkloadSpec(WorkloadSpec *specPtr)
+   {
+    // initialize function/variables
+    int kind;
+
+    // set defaults
+    specPtr->numProcs = DEFAULT_WORK_PROCS;
+    specPtr->opsPerProc = DEFAULT_WORK_OPS;
+    for (kind = 0; kind < NUM_WORK_OP_KINDS; kind++)
+       {
+        specPtr->opMix[ kind ] = 1;
+       }
+    specPtr->minCycles = DEFAULT_WORK_MIN_CYCLES;
+    specPtr->maxCycles = DEFAULT_WORK_MAX_CYCLES;
+    specPtr->segmentSize = DEFAULT_WORK_SEGMENT;
+    specPtr->accessSize = DEFAULT_WORK_ACCESS;
+    specPtr->memPattern = PATTERN_SEQUENTIAL;
+    specPtr->arrivalRate = 0.0;
+    specPtr->seed = DEFAULT_WORK_SEED;
+   }
+
+/*
+ * Function Name: parseMemPattern
+ * Algorithm: matches pattern name against "seq", "rand", and "hot"
+ * Precondition: given pattern name and spec
+ * Postcondition: spec pattern set and True returned, or False returned
+ *                with spec unchanged
+ * Exceptions: unknown name returns False
+ * Notes: "hot" sends most accesses to the first tenth of the segment
+ */
+Boolean parseMemPattern(char *patternStr, WorkloadSpec *specPtr)
+   {
+    // check each pattern name
+    if (compareString(patternStr, "seq") == STR_EQ)
+       {
+        specPtr->memPattern = PATTERN_SEQUENTIAL;
+       }
+    else if (compareString(patternStr, "rand") == STR_EQ)
+       {
+        specPtr->memPattern = PATTERN_RANDOM;
+       }
+    else if (compareString(patternStr, "hot") == STR_EQ)
+       {
+        specPtr->memPattern = PATTERN_HOT;
+       }
+    else
+       {
+        return False;
+       }
+
+    return True;
+   }
+
+/*
+ * Function Name: parseOpMix
+ * Algorithm: reads four colon separated weights, cpu:in:out:mem
+ * Precondition: given mix string and spec
+ * Postcondition: spec op mix set and True returned, or False returned
+ *                with spec unchanged
+ * Exceptions: malformed mix, negative weight, or all zero weights return
+ *             False
+ * Notes: weights are relative, so 2:1:1:0 equals 50:25:25:0
+ */
+Boolean parseOpMix(char *mixStr, WorkloadSpec *specPtr)
+   {
+    // initialize function/variables
+    int weights[ NUM_WORK_OP_KINDS ];
+    int kind, total = 0;
+
+    // read weights
+    if (sscanf(mixStr, "%d:%d:%d:%d", &weights[ WORK_CPU ],
+                &weights[ WORK_IN ], &weights[ WORK_OUT ],
+                            &weights[ WORK_MEM ]) != NUM_WORK_OP_KINDS)
+       {
+        return False;
+       }
+
+    // check for negative or all zero weights
+    for (kind = 0; kind < NUM_WORK_OP_KINDS; kind++)
+       {
+        if (weights[ kind ] < 0)
+           {
+            return False;
+           }
+        total += weights[ kind ];
+       }
+    if (total == 0)
+       {
+        return False;
+       }
+
+    // set mix
+    for (kind = 0; kind < NUM_WORK_OP_KINDS; kind++)
+       {
+        specPtr->opMix[ kind ] = weights[ kind ];
+       }
+    return True;
+   }
+
+/*
+ * Function Name: workloadMemory
+ * Algorithm: totals the segments a workload may allocate
+ * Precondition: given spec
+ * Postcondition: memory needed for every allocation to succeed returned
+ * Exceptions: none
+ * Notes: each process allocates at most one segment
+ */
+int workloadMemory(WorkloadSpec *specPtr)
+   {
+    // check for no memory ops
+    if (specPtr->opMix[ WORK_MEM ] == 0)
+       {
+        return 0;
+       }
+
+    return specPtr->numProcs * specPtr->segmentSize;
+   }
+
+/*
+ * Function Name: writeWorkload
+ * Algorithm: writes meta data file framing, then one generated process
+ *            after another, all drawn from one seed, each arriving at
+ *            time zero or, with an arrival rate, after an exponential gap
+ *            drawn from a second seed
+ * Precondition: given output file name and valid spec
+ * Postcondition: meta data file written and True returned
+ * Exceptions: file that cannot be opened or written returns False
+ * Notes: the same spec always writes the same file; arrivals have their
+ *        own seed so the processes are the same at any rate
+ */
+Boolean writeWorkload(char *fileName, WorkloadSpec *specPtr)
+   {
+    // initialize function/variables
+    FILE *filePtr = fopen(fileName, "w");
+    unsigned int seed = specPtr->seed;
+    unsigned int arrivalSeed = specPtr->seed ^ ARRIVAL_SEED_MIX;
+    double arrivalTime = 0.0;
+    int procIndex;
+
+    // check for file not opened
+    if (filePtr == NULL)
+       {
+        return False;
+       }
+
+    // write framing and processes
+    fprintf(filePtr, "Start Program Meta-Data Code:\n");
+    fprintf(filePtr, "sys start\n");
+    for (procIndex = 0; procIndex < specPtr->numProcs; procIndex++)
+       {
+        writeWorkloadProcess(filePtr, specPtr, &seed, (int)arrivalTime);
+        if (specPtr->arrivalRate > 0.0)
+           {
+            arrivalTime += drawInterarrival(&arrivalSeed,
+                                                      specPtr->arrivalRate);
+           }
+       }
+    fprintf(filePtr, "sys end\n");
+    fprintf(filePtr, "End Program Meta-Data Code.\n");
+
+    // close file, reporting any write failure
+    return fclose(filePtr) == 0;
+   }
+
+/*
+ * Function Name: writeWorkloadProcess
+ * Algorithm: writes one process of the configured number of ops, each
+ *            kind drawn by op mix weight; a process's first memory op
+ *            allocates its segment at address zero and later ones access
+ *            it following the memory pattern
+ * Precondition: given open file, valid spec, seed storage, and arrival
+ *               time in ms
+ * Postcondition: app start through app end lines written, seed advanced
+ * Exceptions: none
+ * Notes: each process has its own segment table, so every process may
+ *        use the same addresses
+ */
+void writeWorkloadProcess(FILE *filePtr, WorkloadSpec *specPtr,
+                                   unsigned int *seedPtr, int arrivalTime)
+   {
+    // initialize function/variables
+    int totalWeight = 0, accessSize = specPtr->accessSize;
+    int hotLimit, cursor = 0, offset, opIndex, kind, draw;
+    Boolean allocated = False;
+
+    // find mix total and access limits within the segment
+    for (kind = 0; kind < NUM_WORK_OP_KINDS; kind++)
+       {
+        totalWeight += specPtr->opMix[ kind ];
+       }
+    if (accessSize > specPtr->segmentSize)
+       {
+        accessSize = specPtr->segmentSize;
+       }
+    hotLimit = specPtr->segmentSize / HOT_REGION_DIVISOR - accessSize;
+    if (hotLimit < 0)
+       {
+        hotLimit = 0;
+       }
+
+    // loop across process ops
+    fprintf(filePtr, "app start %d\n", arrivalTime);
+    for (opIndex = 0; opIndex < specPtr->opsPerProc; opIndex++)
+       {
+        // draw op kind by weight
+        draw = drawRange(seedPtr, 0, totalWeight - 1);
+        kind = 0;
+        while (draw >= specPtr->opMix[ kind ])
+           {
+            draw -= specPtr->opMix[ kind ];
+            kind++;
+           }
+
+        // write op of drawn kind
+        switch (kind)
+           {
+           case WORK_CPU:
+              fprintf(filePtr, "cpu process %d\n", drawRange(seedPtr,
+                                specPtr->minCycles, specPtr->maxCycles));
+              break;
+
+           case WORK_IN:
+              fprintf(filePtr, "dev in %s %d\n",
+                   inDevices[ drawRange(seedPtr, 0, NUM_IN_DEVICES - 1) ],
+                   drawRange(seedPtr, specPtr->minCycles,
+                                                       specPtr->maxCycles));
+              break;
+
+           case WORK_OUT:
+              fprintf(filePtr, "dev out %s %d\n",
+                   outDevices[ drawRange(seedPtr, 0, NUM_OUT_DEVICES - 1) ],
+                   drawRange(seedPtr, specPtr->minCycles,
+                                                       specPtr->maxCycles));
+              break;
+
+           // memory op, allocating first
+           default:
+              if (allocated == False)
+                 {
+                  fprintf(filePtr, "mem allocate 0 %d\n",
+                                                      specPtr->segmentSize);
+                  allocated = True;
+                  break;
+                 }
+
+              // find access offset by pattern
+              if (specPtr->memPattern == PATTERN_RANDOM)
+                 {
+                  offset = drawRange(seedPtr, 0,
+                                      specPtr->segmentSize - accessSize);
+                 }
+              else if (specPtr->memPattern == PATTERN_HOT)
+                 {
+                  offset = drawRange(seedPtr, 1, 100) <= HOT_ACCESS_PERCENT
+                         ? drawRange(seedPtr, 0, hotLimit)
+                         : drawRange(seedPtr, 0,
+                                        specPtr->segmentSize - accessSize);
+                 }
+              else
+                 {
+                  offset = cursor;
+                  cursor += accessSize;
+                  if (cursor + accessSize > specPtr->segmentSize)
+                     {
+                      cursor = 0;
+                     }
+                 }
+              fprintf(filePtr, "mem access %d %d\n", offset, accessSize);
+              break;
+           }
+       }
+    fprintf(filePtr, "app end\n");
+   }
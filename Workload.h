@@ -0,0 +1,73 @@
+// Preprocessor directive
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "StringUtils.h"
+
+// global constants
+#define DEFAULT_WORK_PROCS 100
+#define DEFAULT_WORK_OPS 20
+#define DEFAULT_WORK_MIN_CYCLES 1
+#define DEFAULT_WORK_MAX_CYCLES 20
+#define DEFAULT_WORK_SEGMENT 1024
+#define DEFAULT_WORK_ACCESS 64
+#define DEFAULT_WORK_SEED 1
+#define HOT_ACCESS_PERCENT 90
+#define HOT_REGION_DIVISOR 10
+#define NUM_WORK_OP_KINDS 4
+#define NUM_IN_DEVICES 3
+#define NUM_OUT_DEVICES 3
+#define ARRIVAL_SEED_MIX 0x9E3779B9u
+#define WORK_MS_PER_SEC 1000.0
+
+// kinds of op a generated process draws from, in op mix order
+typedef enum
+   {
+    WORK_CPU,
+    WORK_IN,
+    WORK_OUT,
+    WORK_MEM
+   } WorkOpKind;
+
+// where a process's memory accesses fall within its segment
+typedef enum
+   {
+    PATTERN_SEQUENTIAL,
+    PATTERN_RANDOM,
+    PATTERN_HOT
+   } MemPattern;
+
+// shape of a generated meta data file; op mix entries are relative
+// weights of cpu, input, output, and memory ops; a nonzero arrival rate,
+// in processes per second, spaces process arrivals as a Poisson stream
+// instead of starting every process at time zero
+typedef struct WorkloadSpec
+   {
+    int numProcs;
+    int opsPerProc;
+    int opMix[ NUM_WORK_OP_KINDS ];
+    int minCycles;
+    int maxCycles;
+    int segmentSize;
+    int accessSize;
+    int memPattern;
+    double arrivalRate;
+    unsigned int seed;
+   } WorkloadSpec;
+
+// function prototypes
+double drawInterarrival(unsigned int *seedPtr, double arrivalRate);
+int drawRange(unsigned int *seedPtr, int low, int high);
+void initWorkloadSpec(WorkloadSpec *specPtr);
+Boolean parseMemPattern(char *patternStr, WorkloadSpec *specPtr);
+Boolean parseOpMix(char *mixStr, WorkloadSpec *specPtr);
+int workloadMemory(WorkloadSpec *specPtr);
+Boolean writeWorkload(char *fileName, WorkloadSpec *specPtr);
+void writeWorkloadProcess(FILE *filePtr, WorkloadSpec *specPtr,
+                                  unsigned int *seedPtr, int arrivalTime);
+
+#endif // WORKLOAD_H
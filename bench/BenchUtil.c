@@ -0,0 +1,99 @@
+// header files
+#include "BenchUtil.h"
+
+/*
+ * Function Name: elapsedSeconds
+ * Algorithm: computes difference between two monotonic time stamps
+ * Precondition: given start and end time stamps
+ * Postcondition: elapsed time in seconds returned
+ * Exceptions: none
+ * Notes: none
+ */
+double elapsedSeconds(struct timespec *startPtr, struct timespec *endPtr)
+   {
+    return (double)(endPtr->tv_sec - startPtr->tv_sec)
+                      + (double)(endPtr->tv_nsec - startPtr->tv_nsec) / 1.0e9;
+   }
+
+/*
+ * Function Name: loadWorkload
+ * Algorithm: writes the workload to a temporary file and loads it as a
+ *            meta data list
+ * Precondition: given workload spec and list head storage
+ * Postcondition: list loaded and True returned, temporary file removed
+ * Exceptions: file that cannot be written or loaded is reported and
+ *             returns False
+ * Notes: none
+ */
+Boolean loadWorkload(WorkloadSpec *specPtr, OpCodeType **metaDataPtr)
+   {
+    // initialize function/variables
+    char fileName[] = BENCH_WORKLOAD_TEMPLATE;
+    char errorMsg[ MAX_STR_LEN ];
+    Boolean loaded;
+    int fileDesc;
+
+    // create temporary file
+    fileDesc = mkstemp(fileName);
+    if (fileDesc == -1)
+       {
+        fprintf(stderr, "Unable to create temporary meta data file\n");
+        return False;
+       }
+    close(fileDesc);
+
+    // write and load workload
+    loaded = writeWorkload(fileName, specPtr) == True
+                 && getMetaData(fileName, metaDataPtr, errorMsg) == True;
+    if (loaded == False)
+       {
+        fprintf(stderr, "Unable to load generated workload: %s\n", fileName);
+       }
+    remove(fileName);
+    return loaded;
+   }
+
+/*
+ * Function Name: peakResidentMb
+ * Algorithm: reads the process's peak resident set size
+ * Precondition: none
+ * Postcondition: peak RSS in megabytes returned
+ * Exceptions: none
+ * Notes: Linux reports ru_maxrss in kilobytes
+ */
+double peakResidentMb(void)
+   {
+    // initialize function/variables
+    struct rusage usage;
+
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss / KB_PER_MB;
+   }
+
+/*
+ * Function Name: setBenchConfig
+ * Algorithm: turns off display, log, metrics, and trace output and turns
+ *            on the virtual clock, then raises available memory to what
+ *            the workload needs
+ * Precondition: given loaded config and workload spec, or NULL to leave
+ *               memory as configured
+ * Postcondition: config set to run nothing but the simulation itself
+ * Exceptions: none
+ * Notes: callers needing a trace name it after this call
+ */
+void setBenchConfig(ConfigDataType *configPtr, WorkloadSpec *specPtr)
+   {
+    // turn off everything but the simulation
+    configPtr->virtualClock = True;
+    configPtr->logToCode = LOGTO_MONITOR_CODE;
+    configPtr->memDisplay = False;
+    configPtr->metricsDisplay = False;
+    configPtr->metricsFileName[ 0 ] = NULL_CHAR;
+    configPtr->traceFileName[ 0 ] = NULL_CHAR;
+
+    // make room for the whole workload
+    if (specPtr != NULL && configPtr->memAvailable < workloadMemory(specPtr))
+       {
+        configPtr->memAvailable = workloadMemory(specPtr);
+       }
+   }
@@ -0,0 +1,26 @@
+// Preprocessor directive
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include "StringUtils.h"
+#include "configops.h"
+#include "metadataops.h"
+#include "Workload.h"
+
+// global constants
+#define KB_PER_MB 1024.0
+#define BENCH_WORKLOAD_TEMPLATE "/tmp/BenchWorkloadXXXXXX"
+
+// function prototypes
+double elapsedSeconds(struct timespec *startPtr, struct timespec *endPtr);
+Boolean loadWorkload(WorkloadSpec *specPtr, OpCodeType **metaDataPtr);
+double peakResidentMb(void);
+void setBenchConfig(ConfigDataType *configPtr, WorkloadSpec *specPtr);
+
+#endif // BENCH_UTIL_H
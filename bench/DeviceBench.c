@@ -0,0 +1,148 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include "SimBatch.h"
+#include "BenchUtil.h"
+
+// global constants
+#define DEFAULT_DEVICE_PROCS 200
+#define DEFAULT_SEEK_TIME 20
+#define DEVICE_NUM_ORDERS 4
+
+// I/O heavy op mix of cpu, input, output, and memory ops
+static const int deviceMix[ NUM_WORK_OP_KINDS ] = { 2, 3, 1, 0 };
+
+// device request orders compared, unmodeled devices first
+static const int deviceOrders[ DEVICE_NUM_ORDERS ] =
+   {
+    IO_SCHED_NONE_CODE,
+    IO_SCHED_FIFO_CODE,
+    IO_SCHED_SSTF_CODE,
+    IO_SCHED_SCAN_CODE
+   };
+
+// display names of compared orders
+static const char *orderNames[ DEVICE_NUM_ORDERS ] =
+   {
+    "None",
+    "FIFO",
+    "SSTF",
+    "SCAN"
+   };
+
+/*
+ * Benchmark: device contention and disk request order
+ *
+ * Generates an I/O heavy workload and runs it with devices unmodeled,
+ * where every request runs at once, then with one queue per device taking
+ * requests in FIFO, SSTF, and SCAN order, each seek costing the given
+ * full-stroke time scaled by tracks moved. Each row reports makespan,
+ * throughput, cpu utilization, and the average I/O wait (time blocked,
+ * queueing included) and turnaround time. Runs use the config file's
+ * scheduler with the virtual clock on and nothing displayed, logged, or
+ * traced, so simulated time does not depend on the host.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. bench/DeviceBench.c bench/BenchUtil.c <simulator sources>
+ *                -lpthread -lm
+ * Usage: a.out <config file> [processes] [seek ms] [cpu:in:out:mem]
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: loads the config and sets it for benchmarking, generates the
+ *            workload, then runs it once per device request order and
+ *            displays one row per order
+ * Precondition: given config file name, optional process count, seek
+ *               time, and op mix
+ * Postcondition: results displayed, zero returned if every run completed
+ * Exceptions: bad arguments, unreadable config, or a failed run are
+ *             reported and nonzero returned
+ * Notes: memAvailable is raised to fit the workload
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    ConfigDataType *configPtr = NULL;
+    OpCodeType *metaDataPtr = NULL;
+    char schedStr[ STD_STR_LEN ];
+    char errorMsg[ MAX_STR_LEN ];
+    WorkloadSpec spec;
+    SimMetrics *metricsPtr;
+    SimResult result;
+    int orderIndex, kind, seekTime = DEFAULT_SEEK_TIME;
+
+    // read arguments
+    initWorkloadSpec(&spec);
+    spec.numProcs = DEFAULT_DEVICE_PROCS;
+    for (kind = 0; kind < NUM_WORK_OP_KINDS; kind++)
+       {
+        spec.opMix[ kind ] = deviceMix[ kind ];
+       }
+    if (argc > 2)
+       {
+        spec.numProcs = atoi(argv[ 2 ]);
+       }
+    if (argc > 3)
+       {
+        seekTime = atoi(argv[ 3 ]);
+       }
+    if (argc < 2 || spec.numProcs < 1 || seekTime < 0
+                || (argc > 4 && parseOpMix(argv[ 4 ], &spec) == False))
+       {
+        fprintf(stderr, "Usage: %s <config file> [processes] [seek ms] "
+                                          "[cpu:in:out:mem]\n", argv[ 0 ]);
+        return 1;
+       }
+
+    // load config, turning off everything but the simulation itself
+    if (getConfigData(argv[ 1 ], &configPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        return 1;
+       }
+    setBenchConfig(configPtr, &spec);
+    configPtr->ioSeekTime = seekTime;
+
+    // generate workload
+    if (loadWorkload(&spec, &metaDataPtr) == False)
+       {
+        clearConfigData(configPtr);
+        return 1;
+       }
+
+    // display heading
+    configCodeToString(configPtr->cpuSchedCode, schedStr);
+    printf("Device Request Order (%d processes, %s, full-stroke seek %d ms)"
+                                "\n", spec.numProcs, schedStr, seekTime);
+    printf("%-6s %12s %10s %8s %13s %11s\n", "Order", "Makespan (s)",
+                            "Thruput/s", "CPU", "I/O Wait (ms)", "Turn (ms)");
+
+    // loop across request orders
+    for (orderIndex = 0; orderIndex < DEVICE_NUM_ORDERS; orderIndex++)
+       {
+        configPtr->ioSchedCode = deviceOrders[ orderIndex ];
+        if (runSimulation(configPtr, metaDataPtr, NULL, &result) == False)
+           {
+            fprintf(stderr, "Simulation did not complete\n");
+            clearMetaDataList(metaDataPtr);
+            clearConfigData(configPtr);
+            return 1;
+           }
+
+        // display times and rates
+        metricsPtr = &result.metrics;
+        printf("%-6s %12.3f %10.2f %7.1f%% %13.3f %11.3f\n",
+                 orderNames[ orderIndex ], metricsPtr->makespan,
+                 metricsPtr->throughput,
+                 metricsPtr->cpuUtilization * PERCENT,
+                 metricsPtr->avgIoWait * MS_PER_SEC,
+                                     metricsPtr->avgTurnaround * MS_PER_SEC);
+       }
+
+    // release workload and config
+    clearMetaDataList(metaDataPtr);
+    clearConfigData(configPtr);
+    return 0;
+   }
@@ -0,0 +1,178 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include "SimBatch.h"
+#include "BenchUtil.h"
+
+// global constants
+#define DEFAULT_LOAD_PROCS 1000
+#define LOAD_STEP_PERCENT 10
+#define MAX_LOAD_PERCENT 120
+#define LOAD_NUM_SCHEDS 4
+
+// schedulers compared at every load
+static const int loadScheds[ LOAD_NUM_SCHEDS ] =
+   {
+    CPU_SCHED_FCFS_N_CODE,
+    CPU_SCHED_SJF_N_CODE,
+    CPU_SCHED_RR_P_CODE,
+    CPU_SCHED_MLFQ_P_CODE
+   };
+
+/*
+ * Benchmark: open-system load sweep
+ *
+ * Runs a generated workload with every process arriving at once and takes
+ * its FCFS-N throughput as the system's capacity. Then it generates the
+ * same processes arriving as a Poisson stream at 10%, 20%, and so on up
+ * to 120% of that capacity, and runs each stream under FCFS-N, SJF-N,
+ * RR-P, and MLFQ-P. Each row reports the measured arrival rate and
+ * throughput, cpu utilization, and the average response (queueing delay
+ * before first run), ready waiting, and turnaround times. Runs use the
+ * virtual clock with nothing displayed, logged, or traced, so simulated
+ * time does not depend on the host.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. bench/LoadBench.c bench/BenchUtil.c <simulator sources>
+ *                -lpthread -lm
+ * Usage: a.out <config file> [processes] [cpu:in:out:mem]
+ */
+
+/*
+ * Function Name: runLoad
+ * Algorithm: generates the workload at the given arrival rate, then runs
+ *            it under each scheduler and displays one row per scheduler
+ * Precondition: given benchmark config, workload spec, and load percent of
+ *               capacity the spec's arrival rate stands for
+ * Postcondition: rows displayed, True returned
+ * Exceptions: workload that cannot be loaded, or a run that does not
+ *             complete, is reported and returns False
+ * Notes: config scheduler is changed on each pass
+ */
+Boolean runLoad(ConfigDataType *configPtr, WorkloadSpec *specPtr,
+                                                             int loadPercent)
+   {
+    // initialize function/variables
+    OpCodeType *metaDataPtr = NULL;
+    char schedStr[ STD_STR_LEN ];
+    SimMetrics *metricsPtr;
+    SimResult result;
+    int schedIndex;
+
+    // load workload at this rate
+    if (loadWorkload(specPtr, &metaDataPtr) == False)
+       {
+        return False;
+       }
+
+    // loop across schedulers
+    for (schedIndex = 0; schedIndex < LOAD_NUM_SCHEDS; schedIndex++)
+       {
+        configPtr->cpuSchedCode = loadScheds[ schedIndex ];
+        if (runSimulation(configPtr, metaDataPtr, NULL, &result) == False)
+           {
+            fprintf(stderr, "Simulation did not complete\n");
+            clearMetaDataList(metaDataPtr);
+            return False;
+           }
+
+        // display rates and delays
+        metricsPtr = &result.metrics;
+        configCodeToString(configPtr->cpuSchedCode, schedStr);
+        printf("%-7s %5d%% %10.2f %10.2f %7.1f%% %11.3f %11.3f %11.3f\n",
+                 schedStr, loadPercent, metricsPtr->arrivalRate,
+                 metricsPtr->throughput,
+                 metricsPtr->cpuUtilization * PERCENT,
+                 metricsPtr->avgResponse * MS_PER_SEC,
+                 metricsPtr->avgWaiting * MS_PER_SEC,
+                                     metricsPtr->avgTurnaround * MS_PER_SEC);
+       }
+
+    // release workload
+    clearMetaDataList(metaDataPtr);
+    return True;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: loads the config and sets it for benchmarking, measures
+ *            capacity with every process arriving at once, then runs every
+ *            load step up to the maximum
+ * Precondition: given config file name, optional process count and op mix
+ * Postcondition: results displayed, zero returned if every run completed
+ * Exceptions: bad arguments, unreadable config, or a failed run are
+ *             reported and nonzero returned
+ * Notes: memAvailable is raised to fit the workload
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    ConfigDataType *configPtr = NULL;
+    OpCodeType *metaDataPtr = NULL;
+    WorkloadSpec spec;
+    SimResult result;
+    char errorMsg[ MAX_STR_LEN ];
+    double capacity;
+    int loadPercent;
+
+    // read arguments
+    initWorkloadSpec(&spec);
+    spec.numProcs = DEFAULT_LOAD_PROCS;
+    if (argc > 2)
+       {
+        spec.numProcs = atoi(argv[ 2 ]);
+       }
+    if (argc < 2 || spec.numProcs < 2
+                || (argc > 3 && parseOpMix(argv[ 3 ], &spec) == False))
+       {
+        fprintf(stderr, "Usage: %s <config file> [processes, at least 2] "
+                                          "[cpu:in:out:mem]\n", argv[ 0 ]);
+        return 1;
+       }
+
+    // load config, turning off everything but the simulation itself
+    if (getConfigData(argv[ 1 ], &configPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        return 1;
+       }
+    setBenchConfig(configPtr, &spec);
+
+    // measure capacity with every process arriving at once
+    configPtr->cpuSchedCode = CPU_SCHED_FCFS_N_CODE;
+    if (loadWorkload(&spec, &metaDataPtr) == False
+        || runSimulation(configPtr, metaDataPtr, NULL, &result) == False
+        || result.metrics.throughput <= 0.0)
+       {
+        fprintf(stderr, "Unable to measure capacity\n");
+        clearMetaDataList(metaDataPtr);
+        clearConfigData(configPtr);
+        return 1;
+       }
+    clearMetaDataList(metaDataPtr);
+    capacity = result.metrics.throughput;
+
+    // display heading
+    printf("Open-System Load (%d processes, capacity %.2f per second)\n",
+                                                   spec.numProcs, capacity);
+    printf("%-7s %6s %10s %10s %8s %11s %11s %11s\n", "Sched", "Load",
+            "Arrive/s", "Thruput/s", "CPU", "Resp (ms)", "Wait (ms)",
+                                                              "Turn (ms)");
+
+    // loop across loads of capacity
+    for (loadPercent = LOAD_STEP_PERCENT; loadPercent <= MAX_LOAD_PERCENT;
+                                            loadPercent += LOAD_STEP_PERCENT)
+       {
+        spec.arrivalRate = capacity * loadPercent / PERCENT;
+        if (runLoad(configPtr, &spec, loadPercent) == False)
+           {
+            clearConfigData(configPtr);
+            return 1;
+           }
+       }
+
+    // release config
+    clearConfigData(configPtr);
+    return 0;
+   }
@@ -0,0 +1,172 @@
+// header files
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "MetaLoader.h"
+#include "ProgramCache.h"
+#include "BenchUtil.h"
+
+// global constants
+#define BYTES_PER_MB 1048576.0
+
+/*
+ * Benchmark: mapped meta data loader and program cache versus list loader
+ *
+ * Loads the same meta data file into a program three ways: by mapping it
+ * with mapProgramFile, from the program cache saved from that load, and
+ * through getMetaData's op list and buildProgram. Reports time,
+ * MB/second of meta data, and peak resident set size after each, then
+ * checks that all three programs match op for op. The list loader runs
+ * last, since peak RSS only ever grows. The cache is left beside the meta
+ * data file.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. bench/LoaderBench.c bench/BenchUtil.c MetaLoader.c
+ *                ProgramCache.c SimProgram.c Arena.c OpDecode.c Workload.c
+ *                StringUtils.c metadataops.c -lm
+ * Usage: a.out <meta data file>
+ *    (tools/WorkloadGen writes large meta data files)
+ */
+
+/*
+ * Function Name: programsMatch
+ * Algorithm: compares op arrays, process ranges, and device names
+ * Precondition: given two built programs
+ * Postcondition: True returned if they are the same program
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean programsMatch(SimProgram *leftPtr, SimProgram *rightPtr)
+   {
+    // initialize function/variables
+    int numOps = leftPtr->numOps, numProcs = leftPtr->numProcs;
+    int index;
+
+    // check counts and op arrays
+    if (numOps != rightPtr->numOps || numProcs != rightPtr->numProcs
+        || leftPtr->numDevices != rightPtr->numDevices
+        || memcmp(leftPtr->opKind, rightPtr->opKind, numOps) != 0
+        || memcmp(leftPtr->opDevice, rightPtr->opDevice,
+                                                 sizeof(short) * numOps) != 0
+        || memcmp(leftPtr->opArg2, rightPtr->opArg2,
+                                                   sizeof(int) * numOps) != 0
+        || memcmp(leftPtr->opArg3, rightPtr->opArg3,
+                                                   sizeof(int) * numOps) != 0
+        || memcmp(leftPtr->procStartOp, rightPtr->procStartOp,
+                                                 sizeof(int) * numProcs) != 0
+        || memcmp(leftPtr->procEndOp, rightPtr->procEndOp,
+                                                 sizeof(int) * numProcs) != 0
+        || memcmp(leftPtr->procCpuCycles, rightPtr->procCpuCycles,
+                                                 sizeof(int) * numProcs) != 0
+        || memcmp(leftPtr->procIoCycles, rightPtr->procIoCycles,
+                                                 sizeof(int) * numProcs) != 0)
+       {
+        return False;
+       }
+
+    // check device names
+    for (index = 0; index < leftPtr->numDevices; index++)
+       {
+        if (compareString(leftPtr->deviceNames[ index ],
+                                   rightPtr->deviceNames[ index ]) != STR_EQ)
+           {
+            return False;
+           }
+       }
+
+    return True;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: times each loader on the file, saving the cache between the
+ *            first two, displays results, and compares the programs built
+ * Precondition: given meta data file name
+ * Postcondition: results displayed, zero returned if both loaders agree
+ * Exceptions: unreadable file or failed load reported and nonzero returned
+ * Notes: none
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    SimProgram mappedProgram, cachedProgram, listProgram;
+    OpCodeType *metaDataPtr = NULL;
+    char cacheName[ LARGE_STR_LEN + STD_STR_LEN ];
+    struct stat fileStat;
+    struct timespec start, end;
+    char errorMsg[ MAX_STR_LEN ];
+    double fileMb, mappedTime, cachedTime, listTime;
+    Boolean match;
+
+    // check for file
+    if (argc < 2 || stat(argv[ 1 ], &fileStat) == -1)
+       {
+        fprintf(stderr, "Usage: %s <meta data file>\n", argv[ 0 ]);
+        return 1;
+       }
+    fileMb = fileStat.st_size / BYTES_PER_MB;
+
+    // time mapped loader
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (mapProgramFile(&mappedProgram, argv[ 1 ], errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        return 1;
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    mappedTime = elapsedSeconds(&start, &end);
+    printf("file: %.1f MB, %d ops, %d processes\n", fileMb,
+                              mappedProgram.numOps, mappedProgram.numProcs);
+    printf("mapped loader: %10.3f ms %10.1f MB/sec  peak RSS %8.1f MB\n",
+              mappedTime * 1000.0, fileMb / mappedTime, peakResidentMb());
+
+    // save cache, then time cache loader
+    copyString(cacheName, argv[ 1 ]);
+    strcat(cacheName, CACHE_SUFFIX);
+    if (saveProgramCache(cacheName, &fileStat, &mappedProgram) == False)
+       {
+        fprintf(stderr, "Unable to write cache file: %s\n", cacheName);
+        clearProgram(&mappedProgram);
+        return 1;
+       }
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (loadProgramCache(cacheName, &fileStat, &cachedProgram) == False)
+       {
+        fprintf(stderr, "Unable to load cache file: %s\n", cacheName);
+        clearProgram(&mappedProgram);
+        return 1;
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    cachedTime = elapsedSeconds(&start, &end);
+    printf("cache loader:  %10.3f ms %10.1f MB/sec  peak RSS %8.1f MB\n",
+              cachedTime * 1000.0, fileMb / cachedTime, peakResidentMb());
+
+    // time list loader and program build
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    if (getMetaData(argv[ 1 ], &metaDataPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        clearProgram(&cachedProgram);
+        clearProgram(&mappedProgram);
+        return 1;
+       }
+    buildProgram(&listProgram, metaDataPtr);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    listTime = elapsedSeconds(&start, &end);
+    printf("list loader:   %10.3f ms %10.1f MB/sec  peak RSS %8.1f MB\n",
+                  listTime * 1000.0, fileMb / listTime, peakResidentMb());
+    printf("speedup:       %10.2fx mapped, %.2fx cached\n",
+                                listTime / mappedTime, listTime / cachedTime);
+
+    // compare programs
+    match = programsMatch(&mappedProgram, &listProgram)
+                            && programsMatch(&cachedProgram, &listProgram);
+    printf("programs %s\n", match == True ? "match" : "differ");
+
+    // release memory to OS
+    clearMetaDataList(metaDataPtr);
+    clearProgram(&listProgram);
+    clearProgram(&cachedProgram);
+    clearProgram(&mappedProgram);
+    return match == True ? 0 : 1;
+   }
@@ -0,0 +1,180 @@
+// header files
+#include <stdio.h>
+#include "MemoryMgr.h"
+#include "BenchUtil.h"
+
+// global constants
+#define DEFAULT_BENCH_SEGMENTS 50000
+#define BENCH_SEGMENT_SIZE 64
+#define BENCH_SEGMENT_STRIDE 128
+
+// linked segment node, laid out like the old MMU list
+typedef struct ListSegment
+   {
+    int start;
+    int end;
+    struct ListSegment *nextNode;
+   } ListSegment;
+
+/*
+ * Benchmark: linear MMU list versus sorted segment array
+ *
+ * Allocates the given number of non-overlapping segments in shuffled
+ * order, then performs the same number of accesses, first against a linked
+ * list checked by linear scan (the old addMem/memAccess approach) and then
+ * against a MemoryMgr. Reports ops/second for each path.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. bench/MmuBench.c bench/BenchUtil.c MemoryMgr.c Workload.c
+ *                StringUtils.c metadataops.c -lm
+ * Usage: a.out [number of segments]
+ */
+
+/*
+ * Function Name: listAccess
+ * Algorithm: scans every node for one containing the access range
+ * Precondition: given list head, access start, and size
+ * Postcondition: True returned if a node contains the range
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean listAccess(ListSegment *headPtr, int start, int size)
+   {
+    while (headPtr != NULL)
+       {
+        if (start >= headPtr->start && start + size <= headPtr->end)
+           {
+            return True;
+           }
+
+        headPtr = headPtr->nextNode;
+       }
+
+    return False;
+   }
+
+/*
+ * Function Name: listAllocate
+ * Algorithm: scans every node for overlap, then pushes a new node
+ * Precondition: given list head pointer, segment start, and size
+ * Postcondition: node added and True returned if no overlap was found
+ * Exceptions: none
+ * Notes: none
+ */
+Boolean listAllocate(ListSegment **headPtr, int start, int size)
+   {
+    // initialize function/variables
+    ListSegment *iterator;
+    ListSegment *newNode;
+
+    // check every node for overlap
+    for (iterator = *headPtr; iterator != NULL; iterator = iterator->nextNode)
+       {
+        if (start < iterator->end && start + size > iterator->start)
+           {
+            return False;
+           }
+       }
+
+    // push new node
+    newNode = (ListSegment*)malloc(sizeof(ListSegment));
+    newNode->start = start;
+    newNode->end = start + size;
+    newNode->nextNode = *headPtr;
+    *headPtr = newNode;
+    return True;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: builds a shuffled segment order, times both MMU paths over
+ *            the same allocate and access sequence, and prints ops/second
+ * Precondition: optional segment count on command line
+ * Postcondition: results displayed
+ * Exceptions: none
+ * Notes: none
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    int numSegments = DEFAULT_BENCH_SEGMENTS;
+    int *order;
+    int index, swapIndex, temp, hits = 0;
+    ListSegment *listHead = NULL, *listNode;
+    MemoryMgr memory;
+    struct timespec start, end;
+    double listTime, sortedTime;
+
+    // read segment count, if given
+    if (argc > 1)
+       {
+        numSegments = atoi(argv[1]);
+       }
+
+    // shuffle segment slots with a fixed seed so runs are repeatable
+    order = (int*)malloc(sizeof(int) * numSegments);
+    for (index = 0; index < numSegments; index++)
+       {
+        order[ index ] = index;
+       }
+    srand(1);
+    for (index = numSegments - 1; index > 0; index--)
+       {
+        swapIndex = rand() % (index + 1);
+        temp = order[ index ];
+        order[ index ] = order[ swapIndex ];
+        order[ swapIndex ] = temp;
+       }
+
+    // time linear list path
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (index = 0; index < numSegments; index++)
+       {
+        listAllocate(&listHead, order[ index ] * BENCH_SEGMENT_STRIDE,
+                                                        BENCH_SEGMENT_SIZE);
+       }
+    for (index = 0; index < numSegments; index++)
+       {
+        hits += listAccess(listHead, order[ index ] * BENCH_SEGMENT_STRIDE
+                                               + 1, BENCH_SEGMENT_SIZE / 2);
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    listTime = elapsedSeconds(&start, &end);
+
+    // time sorted array path
+    initMemoryMgr(&memory, numSegments * BENCH_SEGMENT_STRIDE, 1,
+                                                 MEM_FIT_NONE_CODE, False);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (index = 0; index < numSegments; index++)
+       {
+        allocateSegment(&memory, 0,
+                 order[ index ] * BENCH_SEGMENT_STRIDE, BENCH_SEGMENT_SIZE);
+       }
+    for (index = 0; index < numSegments; index++)
+       {
+        hits += accessSegment(&memory, 0, order[ index ]
+                     * BENCH_SEGMENT_STRIDE + 1, BENCH_SEGMENT_SIZE / 2);
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    sortedTime = elapsedSeconds(&start, &end);
+
+    // display results
+    printf("segments: %d (access hits %d of %d)\n", numSegments, hits,
+                                                           numSegments * 2);
+    printf("linear list:  %12.0f ops/sec\n", 2 * numSegments / listTime);
+    printf("sorted array: %12.0f ops/sec\n", 2 * numSegments / sortedTime);
+    printf("speedup:      %12.2fx\n", listTime / sortedTime);
+
+    // release memory to OS
+    while (listHead != NULL)
+       {
+        listNode = listHead;
+        listHead = listHead->nextNode;
+        free(listNode);
+       }
+    clearMemoryMgr(&memory);
+    free(order);
+
+    // return success
+    return 0;
+   }
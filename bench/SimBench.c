@@ -0,0 +1,201 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include "SimBatch.h"
+#include "BenchUtil.h"
+
+// global constants
+#define DEFAULT_BENCH_MAX_PROCS 10000
+#define DEFAULT_BENCH_REPEATS 3
+#define MAX_BENCH_REPEATS 15
+#define BENCH_FIRST_SCALE 100
+#define BENCH_SCALE_STEP 10
+#define BENCH_NUM_SCHEDS 3
+
+// schedulers compared at every scale
+static const int benchScheds[ BENCH_NUM_SCHEDS ] =
+   {
+    CPU_SCHED_FCFS_N_CODE,
+    CPU_SCHED_SJF_N_CODE,
+    CPU_SCHED_MLFQ_P_CODE
+   };
+
+/*
+ * Benchmark: simulator throughput across schedulers and scales
+ *
+ * Generates a workload of 100 processes, then ten times as many, and so
+ * on up to the given maximum. Each workload is run under FCFS-N, SJF-N,
+ * and MLFQ-P the given number of times, using the config file's settings
+ * otherwise but with the virtual clock on and nothing displayed, logged,
+ * or traced, so only the simulator's own work is timed. The table
+ * reports the best and median wall time, ops/second and mean ns per op
+ * from the median run, and peak resident set size so far. Peak RSS only
+ * ever grows, and scales run smallest first, so each row shows the peak
+ * reached by the largest workload run up to that point.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. bench/SimBench.c bench/BenchUtil.c <simulator sources>
+ *                -lpthread -lm
+ * Usage: a.out <config file> [max processes] [repeats] [cpu:in:out:mem]
+ */
+
+/*
+ * Function Name: compareSeconds
+ * Algorithm: orders two times for qsort
+ * Precondition: given pointers to two doubles
+ * Postcondition: negative, zero, or positive returned
+ * Exceptions: none
+ * Notes: none
+ */
+int compareSeconds(const void *leftPtr, const void *rightPtr)
+   {
+    // initialize function/variables
+    double left = *(const double*)leftPtr;
+    double right = *(const double*)rightPtr;
+
+    return (left > right) - (left < right);
+   }
+
+/*
+ * Function Name: runScale
+ * Algorithm: generates and loads a workload of the given size, then
+ *            times repeated runs under each benchmarked scheduler and
+ *            displays one row per scheduler
+ * Precondition: given benchmark config, workload spec, and repeat count
+ * Postcondition: rows displayed, True returned
+ * Exceptions: workload that cannot be written or loaded, or a run that
+ *             does not complete, is reported and returns False
+ * Notes: config scheduler is changed on each pass
+ */
+Boolean runScale(ConfigDataType *configPtr, WorkloadSpec *specPtr,
+                                                                int repeats)
+   {
+    // initialize function/variables
+    char schedStr[ STD_STR_LEN ];
+    double times[ MAX_BENCH_REPEATS ];
+    double median;
+    OpCodeType *metaDataPtr = NULL;
+    SimResult result;
+    struct timespec startTime, endTime;
+    int schedIndex, runIndex;
+
+    // generate workload
+    if (loadWorkload(specPtr, &metaDataPtr) == False)
+       {
+        return False;
+       }
+
+    // loop across schedulers
+    for (schedIndex = 0; schedIndex < BENCH_NUM_SCHEDS; schedIndex++)
+       {
+        configPtr->cpuSchedCode = benchScheds[ schedIndex ];
+
+        // time each run
+        for (runIndex = 0; runIndex < repeats; runIndex++)
+           {
+            clock_gettime(CLOCK_MONOTONIC, &startTime);
+            if (runSimulation(configPtr, metaDataPtr, NULL, &result) == False)
+               {
+                fprintf(stderr, "Simulation did not complete\n");
+                clearMetaDataList(metaDataPtr);
+                return False;
+               }
+            clock_gettime(CLOCK_MONOTONIC, &endTime);
+            times[ runIndex ] = elapsedSeconds(&startTime, &endTime);
+           }
+
+        // display best and median
+        qsort(times, repeats, sizeof(double), &compareSeconds);
+        median = times[ repeats / 2 ];
+        configCodeToString(configPtr->cpuSchedCode, schedStr);
+        printf("%-7s %8d %10d %11.3f %11.3f %12.0f %9.1f %10.1f\n",
+                 schedStr, result.numProcs, result.numOps,
+                 times[ 0 ] * MS_PER_SEC, median * MS_PER_SEC,
+                 result.numOps / median, median * NANO_PER_SEC / result.numOps,
+                                                           peakResidentMb());
+       }
+
+    // release workload
+    clearMetaDataList(metaDataPtr);
+    return True;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: loads the config and sets it for benchmarking, then runs
+ *            every scale up to the maximum
+ * Precondition: given config file name, optional maximum processes,
+ *               repeat count, and op mix
+ * Postcondition: results displayed, zero returned if every run completed
+ * Exceptions: bad arguments, unreadable config, or a failed scale are
+ *             reported and nonzero returned
+ * Notes: memAvailable is raised to fit the largest workload
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    ConfigDataType *configPtr = NULL;
+    WorkloadSpec spec;
+    char errorMsg[ MAX_STR_LEN ];
+    int maxProcs = DEFAULT_BENCH_MAX_PROCS;
+    int repeats = DEFAULT_BENCH_REPEATS;
+    int numProcs, exitCode = 0;
+
+    // read arguments
+    initWorkloadSpec(&spec);
+    if (argc > 2)
+       {
+        maxProcs = atoi(argv[ 2 ]);
+       }
+    if (argc > 3)
+       {
+        repeats = atoi(argv[ 3 ]);
+       }
+    if (argc < 2 || maxProcs < 1 || repeats < 1
+                || repeats > MAX_BENCH_REPEATS
+                || (argc > 4 && parseOpMix(argv[ 4 ], &spec) == False))
+       {
+        fprintf(stderr, "Usage: %s <config file> [max processes] "
+                        "[repeats, 1 to %d] [cpu:in:out:mem]\n", argv[ 0 ],
+                                                        MAX_BENCH_REPEATS);
+        return 1;
+       }
+
+    // load config, turning off everything but the simulation itself
+    if (getConfigData(argv[ 1 ], &configPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        return 1;
+       }
+    spec.numProcs = maxProcs;
+    setBenchConfig(configPtr, &spec);
+
+    // display heading
+    printf("Simulator Benchmark (%d ops per process, median of %d runs)\n",
+                                                   spec.opsPerProc, repeats);
+    printf("%-7s %8s %10s %11s %11s %12s %9s %10s\n", "Sched", "Procs",
+            "Ops", "Best (ms)", "Median (ms)", "Ops/sec", "ns/op",
+                                                             "Peak RSS MB");
+
+    // loop across scales, ending at the maximum
+    numProcs = BENCH_FIRST_SCALE < maxProcs ? BENCH_FIRST_SCALE : maxProcs;
+    while (exitCode == 0)
+       {
+        spec.numProcs = numProcs;
+        if (runScale(configPtr, &spec, repeats) == False)
+           {
+            exitCode = 1;
+           }
+        else if (numProcs == maxProcs)
+           {
+            break;
+           }
+        numProcs = numProcs * BENCH_SCALE_STEP < maxProcs
+                                 ? numProcs * BENCH_SCALE_STEP : maxProcs;
+       }
+
+    // release config
+    clearConfigData(configPtr);
+    return exitCode;
+   }
@@ -0,0 +1,92 @@
+// header files
+#include <stdio.h>
+#include "WorkerPool.h"
+#include "BenchUtil.h"
+
+// global constants
+#define DEFAULT_BENCH_OPS 100000
+
+/*
+ * Benchmark: spawn-per-op versus persistent worker pool
+ *
+ * Runs the same zero-length op the way runSim used to (one pthread_create
+ * and pthread_join per op) and through a WorkerPool (one queue push/pop per
+ * op), then reports ops/second for each path.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. bench/WorkerPoolBench.c bench/BenchUtil.c WorkerPool.c
+ *                Workload.c StringUtils.c metadataops.c -lpthread -lm
+ * Usage: a.out [number of ops]
+ */
+
+/*
+ * Function Name: benchOp
+ * Algorithm: zero-length op; stands in for threadOp with a timer of zero
+ * Precondition: given counter pointer
+ * Postcondition: counter incremented
+ * Exceptions: none
+ * Notes: none
+ */
+void *benchOp(void *counter)
+   {
+    // count completed op and return
+    int *countVal = counter;
+    (*countVal)++;
+    return NULL;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: times both op execution paths and prints ops/second
+ * Precondition: optional op count on command line
+ * Postcondition: results displayed
+ * Exceptions: none
+ * Notes: none
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    int numOps = DEFAULT_BENCH_OPS;
+    int counter = 0;
+    int index;
+    pthread_t opThread;
+    WorkerPool *pool;
+    struct timespec start, end;
+    double spawnTime, poolTime;
+
+    // read op count, if given
+    if (argc > 1)
+       {
+        numOps = atoi(argv[1]);
+       }
+
+    // time spawn-per-op path
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (index = 0; index < numOps; index++)
+       {
+        pthread_create(&opThread, NULL, &benchOp, &counter);
+        pthread_join(opThread, NULL);
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    spawnTime = elapsedSeconds(&start, &end);
+
+    // time worker pool path
+    pool = createWorkerPool(DEFAULT_POOL_THREADS);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (index = 0; index < numOps; index++)
+       {
+        runPoolJob(pool, &benchOp, &counter);
+       }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    poolTime = elapsedSeconds(&start, &end);
+    pool = destroyWorkerPool(pool);
+
+    // display results
+    printf("ops per path: %d (completed %d)\n", numOps, counter);
+    printf("spawn-per-op: %12.0f ops/sec\n", numOps / spawnTime);
+    printf("worker pool:  %12.0f ops/sec\n", numOps / poolTime);
+    printf("speedup:      %12.2fx\n", spawnTime / poolTime);
+
+    // return success
+    return 0;
+   }
@@ -0,0 +1,146 @@
+// header files
+#include <stdio.h>
+#include <string.h>
+#include "DeviceSet.h"
+
+// global constants
+#define DEVICE_CHECK_HEAD 53
+#define DEVICE_CHECK_SEEK_TIME 10
+#define NUM_DEVICE_REQUESTS 8
+#define NUM_DEVICE_CASES 4
+#define MAX_ORDER_LEN 256
+#define MAX_TRACK_LEN 16
+
+// one request order, starting sweep direction, and the service order,
+// head movement, and seek ms it must give
+typedef struct DeviceCase
+   {
+    const char *caseName;
+    int schedCode;
+    Boolean sweepUp;
+    const char *expectedOrder;
+    long expectedTracks;
+    int expectedSeekTime;
+   } DeviceCase;
+
+// textbook request queue, in arrival order, with the head at track 53
+static const int deviceTracks[ NUM_DEVICE_REQUESTS ] =
+   {
+    98, 183, 37, 122, 14, 124, 65, 67
+   };
+
+// request orders checked; with a 10 ms full stroke over 1000 tracks each
+// move costs its distance over 100 tracks, rounded up, in ms
+static const DeviceCase deviceCases[ NUM_DEVICE_CASES ] =
+   {
+    { "FIFO", IO_SCHED_FIFO_CODE, True,
+                            "98 183 37 122 14 124 65 67", 640, 11 },
+    { "SSTF", IO_SCHED_SSTF_CODE, True,
+                            "65 67 37 14 98 122 124 183", 236, 8 },
+    { "SCAN up", IO_SCHED_SCAN_CODE, True,
+                            "65 67 98 122 124 183 37 14", 299, 9 },
+    { "SCAN down", IO_SCHED_SCAN_CODE, False,
+                            "37 14 65 67 98 122 124 183", 208, 8 }
+   };
+
+/*
+ * Check: disk request service order
+ *
+ * Queues the textbook eight request disk queue on one device and serves
+ * it in FIFO, SSTF, and SCAN order, SCAN starting both up and down, and
+ * compares the tracks served, total head movement, and seek time charged
+ * against the values worked by hand. Service order depends only on the
+ * tracks queued and the head position, so any difference is a request
+ * ordering change.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. tests/DeviceCheck.c <simulator sources> -lpthread -lm
+ * Usage: a.out
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: for each order, links every request onto an idle device with
+ *            its head at the starting track, then takes and starts
+ *            requests until the queue is empty, noting each track served
+ *            and the seek time beyond each request's own time
+ * Precondition: none
+ * Postcondition: one line displayed per order, zero returned if every
+ *                order, movement, and seek time matched
+ * Exceptions: none
+ * Notes: requests take no device time of their own, so their service
+ *        time is all seek
+ */
+int main(void)
+   {
+    // initialize function/variables
+    IoRequest requests[ NUM_DEVICE_REQUESTS ];
+    char orderStr[ MAX_ORDER_LEN ];
+    char trackStr[ MAX_TRACK_LEN ];
+    const DeviceCase *casePtr;
+    IoRequest *requestPtr;
+    DeviceSet deviceSet;
+    IoDevice device;
+    int caseIndex, index, seekTime, numFailed = 0;
+    Boolean matched;
+
+    // set one device sharing the check's seek time
+    memset(&deviceSet, 0, sizeof(DeviceSet));
+    deviceSet.devices = &device;
+    deviceSet.numDevices = 1;
+    deviceSet.seekTime = DEVICE_CHECK_SEEK_TIME;
+
+    // loop across orders
+    for (caseIndex = 0; caseIndex < NUM_DEVICE_CASES; caseIndex++)
+       {
+        casePtr = &deviceCases[ caseIndex ];
+        memset(&device, 0, sizeof(IoDevice));
+        device.setPtr = &deviceSet;
+        device.headTrack = DEVICE_CHECK_HEAD;
+        device.sweepUp = casePtr->sweepUp;
+        deviceSet.schedCode = casePtr->schedCode;
+
+        // queue requests in arrival order
+        memset(requests, 0, sizeof(requests));
+        for (index = 0; index < NUM_DEVICE_REQUESTS; index++)
+           {
+            requests[ index ].trackNum = deviceTracks[ index ];
+            requests[ index ].nextNode = index + 1 < NUM_DEVICE_REQUESTS
+                                             ? &requests[ index + 1 ] : NULL;
+           }
+        device.headPtr = &requests[ 0 ];
+        device.tailPtr = &requests[ NUM_DEVICE_REQUESTS - 1 ];
+
+        // serve queue, noting tracks and seek time
+        orderStr[ 0 ] = NULL_CHAR;
+        seekTime = 0;
+        while (device.headPtr != NULL)
+           {
+            requestPtr = pickDeviceRequest(&device, casePtr->schedCode);
+            seekTime += startDeviceIo(&device, requestPtr, 0.0);
+            sprintf(trackStr, "%s%d", orderStr[ 0 ] == NULL_CHAR ? "" : " ",
+                                                      requestPtr->trackNum);
+            strcat(orderStr, trackStr);
+           }
+
+        // compare and display order and costs
+        matched = strcmp(orderStr, casePtr->expectedOrder) == 0
+                  && device.tracksMoved == casePtr->expectedTracks
+                  && seekTime == casePtr->expectedSeekTime;
+        printf("%-9s %s\n", casePtr->caseName,
+                                       matched == True ? "ok" : "FAILED");
+        if (matched == False)
+           {
+            printf("   expected: %s, %ld tracks, %d ms\n"
+                   "   actual:   %s, %ld tracks, %d ms\n",
+                   casePtr->expectedOrder, casePtr->expectedTracks,
+                   casePtr->expectedSeekTime, orderStr, device.tracksMoved,
+                                                                   seekTime);
+            numFailed++;
+           }
+       }
+
+    // return zero if every order matched
+    return numFailed > 0 ? 1 : 0;
+   }
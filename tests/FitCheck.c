@@ -0,0 +1,146 @@
+// header files
+#include <stdio.h>
+#include <string.h>
+#include "MemoryMgr.h"
+
+// global constants
+#define FIT_CHECK_MEMORY 1000
+#define FIT_CHECK_PROCS 8
+#define FIT_CHECK_FRAG_PER_MILLE 538
+#define NUM_FIRST_ALLOCS 5
+#define NUM_FIT_CASES 5
+#define MAX_LATE_ALLOCS 2
+#define MAX_PLACED_LEN 64
+#define MAX_BASE_LEN 16
+#define PER_MILLE 1000.0
+
+// one placement policy, with or without compaction, the segment sizes
+// requested once holes are left, and the physical bases they must get,
+// "-" for a request that cannot be placed, and the bytes compaction moves
+typedef struct FitCase
+   {
+    const char *caseName;
+    int fitCode;
+    Boolean compaction;
+    int lateSizes[ MAX_LATE_ALLOCS ];
+    const char *expectedBases;
+    int expectedMoved;
+   } FitCase;
+
+// segments placed first, one per process from 0 up; freeing processes 1
+// and 3 then leaves holes of 300 at 100, 200 at 550, and 150 at 850
+static const int firstSizes[ NUM_FIRST_ALLOCS ] = { 100, 300, 150, 200, 100 };
+
+// placements checked; a zero size ends a case's requests
+static const FitCase fitCases[ NUM_FIT_CASES ] =
+   {
+    { "First fit", MEM_FIT_FIRST_CODE, False, { 120, 180 }, "100 220", 0 },
+    { "Best fit", MEM_FIT_BEST_CODE, False, { 120, 180 }, "850 550", 0 },
+    { "Worst fit", MEM_FIT_WORST_CODE, False, { 120, 180 }, "100 550", 0 },
+    { "No compact", MEM_FIT_FIRST_CODE, False, { 400, 0 }, "-", 0 },
+    { "Compact", MEM_FIT_FIRST_CODE, True, { 400, 0 }, "350", 250 }
+   };
+
+/*
+ * Check: segment placement and compaction
+ *
+ * Places five segments in 1000 bytes, frees two to leave three holes, and
+ * then places later segments under first, best, and worst fit, comparing
+ * the physical base each gets against the base worked by hand. A request
+ * larger than any hole but within free memory must fail without
+ * compaction and, with it, be placed above the packed segments after
+ * moving the expected bytes. External fragmentation once the holes are
+ * left must be 1 - 300 / 650 in every case.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. tests/FitCheck.c MemoryMgr.c StringUtils.c
+ * Usage: a.out
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: for each case, places the first segments, frees two
+ *            processes, checks fragmentation, then places the case's
+ *            later segments, noting each base and the bytes moved
+ * Precondition: none
+ * Postcondition: one line displayed per case, zero returned if every
+ *                base, fragmentation, and move count matched
+ * Exceptions: a first segment that cannot be placed is a failure
+ * Notes: every segment starts at address 0 of its own process
+ */
+int main(void)
+   {
+    // initialize function/variables
+    char basesStr[ MAX_PLACED_LEN ];
+    char baseStr[ MAX_BASE_LEN ];
+    const FitCase *casePtr;
+    MemoryMgr mgr;
+    int caseIndex, index, pid, fragPerMille, numFailed = 0;
+    Boolean placed, matched;
+
+    // loop across cases
+    for (caseIndex = 0; caseIndex < NUM_FIT_CASES; caseIndex++)
+       {
+        casePtr = &fitCases[ caseIndex ];
+        initMemoryMgr(&mgr, FIT_CHECK_MEMORY, FIT_CHECK_PROCS,
+                                       casePtr->fitCode, casePtr->compaction);
+
+        // place first segments, then free processes 1 and 3
+        placed = True;
+        for (pid = 0; pid < NUM_FIRST_ALLOCS; pid++)
+           {
+            if (allocateSegment(&mgr, pid, 0, firstSizes[ pid ]) == False)
+               {
+                placed = False;
+               }
+           }
+        releaseProcessMemory(&mgr, 1);
+        releaseProcessMemory(&mgr, 3);
+        updateFragmentation(&mgr, 0.0);
+        fragPerMille = (int)(mgr.fragmentation * PER_MILLE + 0.5);
+
+        // place later segments, noting bases
+        basesStr[ 0 ] = NULL_CHAR;
+        for (index = 0; index < MAX_LATE_ALLOCS
+                                  && casePtr->lateSizes[ index ] > 0; index++)
+           {
+            pid = NUM_FIRST_ALLOCS + index;
+            if (allocateSegment(&mgr, pid, 0, casePtr->lateSizes[ index ])
+                                                                     == True)
+               {
+                sprintf(baseStr, "%d", mgr.tables[ pid ].segments[ 0 ]
+                                                                   .physBase);
+               }
+            else
+               {
+                copyString(baseStr, "-");
+               }
+            if (index > 0)
+               {
+                strcat(basesStr, " ");
+               }
+            strcat(basesStr, baseStr);
+           }
+
+        // compare and display placements
+        matched = placed == True
+                  && fragPerMille == FIT_CHECK_FRAG_PER_MILLE
+                  && strcmp(basesStr, casePtr->expectedBases) == 0
+                  && mgr.bytesMoved == casePtr->expectedMoved;
+        printf("%-10s %s\n", casePtr->caseName,
+                                       matched == True ? "ok" : "FAILED");
+        if (matched == False)
+           {
+            printf("   expected: bases %s, %d moved, fragmentation %d/1000\n"
+                   "   actual:   bases %s, %ld moved, fragmentation %d/1000\n",
+                   casePtr->expectedBases, casePtr->expectedMoved,
+                   FIT_CHECK_FRAG_PER_MILLE, basesStr, mgr.bytesMoved,
+                                                               fragPerMille);
+            numFailed++;
+           }
+        clearMemoryMgr(&mgr);
+       }
+
+    // return zero if every placement matched
+    return numFailed > 0 ? 1 : 0;
+   }
@@ -0,0 +1,116 @@
+// header files
+#include <stdio.h>
+#include "Paging.h"
+
+// global constants
+#define PAGING_CHECK_FRAMES 3
+#define PAGING_CHECK_PAGE_SIZE 256
+#define PAGING_CHECK_TLB 4
+#define PAGING_CHECK_PROCS 8
+#define NUM_PAGING_REFS 20
+#define NUM_PAGING_CASES 3
+
+// one replacement policy and the faults it must take on the reference
+// string
+typedef struct PagingCase
+   {
+    const char *caseName;
+    int replaceCode;
+    long expectedFaults;
+   } PagingCase;
+
+// textbook reference string; each number is its own process touching its
+// page 0, as an address space holds no more pages than there are frames
+static const int pagingRefs[ NUM_PAGING_REFS ] =
+   {
+    7, 0, 1, 2, 0, 3, 0, 4, 2, 3, 0, 3, 2, 1, 2, 0, 1, 7, 0, 1
+   };
+
+// replacement policies checked; FIFO and LRU give the textbook counts, and
+// the clock hand sweeps frames in order from frame 0
+static const PagingCase pagingCases[ NUM_PAGING_CASES ] =
+   {
+    { "FIFO", PAGE_FIFO_CODE, 15 },
+    { "LRU", PAGE_LRU_CODE, 12 },
+    { "Clock", PAGE_CLOCK_CODE, 14 }
+   };
+
+/*
+ * Check: page replacement fault counts
+ *
+ * Runs the textbook twenty reference string through three frames under
+ * FIFO, LRU, and Clock replacement, and compares the page faults and
+ * evictions each takes against the counts worked by hand. Faults depend
+ * only on the reference order, so any difference is a replacement change.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. tests/PagingCheck.c Paging.c StringUtils.c
+ * Usage: a.out
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: for each policy, maps one page per process, touches pages in
+ *            reference order, then compares fault and eviction totals
+ * Precondition: none
+ * Postcondition: one line displayed per policy, zero returned if every
+ *                count matched
+ * Exceptions: a rejected access is reported as a failure
+ * Notes: the TLB is smaller than the string's working set, so hits and
+ *        misses both occur without changing fault counts
+ */
+int main(void)
+   {
+    // initialize function/variables
+    const PagingCase *casePtr;
+    PagingMgr pager;
+    int caseIndex, refIndex, pid, faults, accessFaults, numFailed = 0;
+    Boolean accessed, matched;
+
+    // loop across policies
+    for (caseIndex = 0; caseIndex < NUM_PAGING_CASES; caseIndex++)
+       {
+        casePtr = &pagingCases[ caseIndex ];
+        initPagingMgr(&pager, PAGING_CHECK_FRAMES * PAGING_CHECK_PAGE_SIZE,
+                              PAGING_CHECK_PAGE_SIZE, PAGING_CHECK_TLB,
+                                 casePtr->replaceCode, PAGING_CHECK_PROCS);
+
+        // map page 0 of every process, then touch pages in order
+        accessed = True;
+        for (pid = 0; pid < PAGING_CHECK_PROCS; pid++)
+           {
+            allocatePages(&pager, pid, 0, PAGING_CHECK_PAGE_SIZE);
+           }
+        faults = 0;
+        for (refIndex = 0; refIndex < NUM_PAGING_REFS; refIndex++)
+           {
+            if (accessPages(&pager, pagingRefs[ refIndex ], 0, 1,
+                                                  &accessFaults) == False)
+               {
+                accessed = False;
+               }
+            faults += accessFaults;
+           }
+
+        // compare and display counts
+        matched = accessed == True && faults == casePtr->expectedFaults
+                  && pager.pageFaults == casePtr->expectedFaults
+                  && pager.evictions
+                          == casePtr->expectedFaults - PAGING_CHECK_FRAMES;
+        printf("%-6s %s\n", casePtr->caseName,
+                                       matched == True ? "ok" : "FAILED");
+        if (matched == False)
+           {
+            printf("   expected: %ld faults, %ld evictions\n"
+                   "   actual:   %ld faults, %ld evictions\n",
+                   casePtr->expectedFaults,
+                   casePtr->expectedFaults - PAGING_CHECK_FRAMES,
+                                          pager.pageFaults, pager.evictions);
+            numFailed++;
+           }
+        clearPagingMgr(&pager);
+       }
+
+    // return zero if every count matched
+    return numFailed > 0 ? 1 : 0;
+   }
@@ -0,0 +1,232 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "SimContext.h"
+#include "../bench/BenchUtil.h"
+
+// global constants
+#define SCHED_CHECK_WORKLOAD "tests/SchedCheck.mdf"
+#define SCHED_CHECK_TRACE "/tmp/SchedCheckXXXXXX"
+#define SCHED_CHECK_CYCLE_MS 10
+#define SCHED_CHECK_QUANTUM 2
+#define SCHED_CHECK_LEVELS 3
+#define SCHED_CHECK_SCALE 2
+#define SCHED_CHECK_MEMORY 1024
+#define NUM_SCHED_CASES 6
+#define MAX_ORDER_LEN 1024
+#define MAX_DISPATCH_LEN 32
+
+// one scheduler run: code, aging interval in ms (zero for none), and the
+// dispatch order expected, each entry the pid and virtual ms it started
+typedef struct SchedCase
+   {
+    const char *caseName;
+    int schedCode;
+    int agingTime;
+    const char *expectedOrder;
+   } SchedCase;
+
+// scheduler runs checked; P0 needs 5 cycles, P1 4, P2 1 arriving at
+// 10 ms, and P3 12, with 10 ms cycles and a 2 cycle top level quantum
+// doubling at each of three levels; a preempted process is requeued
+// before interrupts raised during its slice are serviced, and a process
+// using up its quantum with only its app end left exits without waiting
+static const SchedCase schedCases[ NUM_SCHED_CASES ] =
+   {
+    { "FCFS-N", CPU_SCHED_FCFS_N_CODE, 0, "0@0 1@50 3@90 2@210" },
+    { "SJF-N", CPU_SCHED_SJF_N_CODE, 0, "1@0 2@40 0@50 3@100" },
+    { "SRTF-P", CPU_SCHED_SRTF_P_CODE, 0, "1@0 2@20 1@30 0@50 3@100" },
+    { "RR-P", CPU_SCHED_RR_P_CODE, 0,
+      "0@0 1@20 3@40 0@60 2@80 1@90 3@110 0@130 3@140 3@160 3@180 3@200" },
+    { "MLFQ-P", CPU_SCHED_MLFQ_P_CODE, 0,
+                          "0@0 1@20 3@40 2@60 0@70 1@100 3@120 3@160" },
+    { "MLFQ-P aged", CPU_SCHED_MLFQ_P_CODE, 100,
+                          "0@0 1@20 3@40 2@60 0@70 1@100 3@120 3@140 3@180" }
+   };
+
+/*
+ * Check: scheduler dispatch order
+ *
+ * Runs a four process workload, one arriving late, under FCFS, SJF,
+ * SRTF, Round Robin, and the multilevel feedback queue with and without
+ * aging, on one core with the virtual clock on, and compares the order and
+ * virtual times of every dispatch, read back from the binary trace,
+ * against the order each policy must give. Simulated time does not depend
+ * on the host, so any difference is a scheduling change.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. tests/SchedCheck.c bench/BenchUtil.c <simulator sources>
+ *                -lpthread -lm
+ * Usage: a.out <config file> [meta data file]
+ */
+
+/*
+ * Function Name: readDispatchOrder
+ * Algorithm: checks the trace header, then appends the pid and virtual ms
+ *            of each READY to RUNNING record, skipping device name bytes
+ * Precondition: given trace file name and order string storage
+ * Postcondition: order string filled in, True returned if trace was read
+ * Exceptions: missing or malformed trace returns False
+ * Notes: entries are separated by single spaces
+ */
+Boolean readDispatchOrder(char *traceFileName, char *orderStr)
+   {
+    // initialize function/variables
+    char magic[ TRACE_MAGIC_LEN ];
+    char entryStr[ MAX_DISPATCH_LEN ];
+    TraceRecord record;
+    FILE *tracePtr;
+    int version;
+
+    // open trace and check header
+    orderStr[ 0 ] = NULL_CHAR;
+    tracePtr = fopen(traceFileName, "rb");
+    if (tracePtr == NULL)
+       {
+        return False;
+       }
+    if (fread(magic, 1, TRACE_MAGIC_LEN, tracePtr) != TRACE_MAGIC_LEN
+        || memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LEN) != 0
+        || fread(&version, sizeof(int), 1, tracePtr) != 1
+        || version != TRACE_VERSION)
+       {
+        fclose(tracePtr);
+        return False;
+       }
+
+    // collect dispatches in order
+    while (fread(&record, sizeof(TraceRecord), 1, tracePtr) == 1)
+       {
+        if (record.eventCode == EVT_DEVICE_NAME)
+           {
+            fseek(tracePtr, (long)record.eventArg, SEEK_CUR);
+           }
+        else if (record.eventCode == EVT_READY_TO_RUNNING
+                  && strlen(orderStr) + MAX_DISPATCH_LEN < MAX_ORDER_LEN)
+           {
+            sprintf(entryStr, "%s%d@%.0f", orderStr[ 0 ] == NULL_CHAR
+                                                 ? "" : " ", record.pid,
+                                           record.eventTime * MS_PER_SEC);
+            strcat(orderStr, entryStr);
+           }
+       }
+
+    // close trace and return success
+    fclose(tracePtr);
+    return True;
+   }
+
+/*
+ * Function Name: main
+ * Algorithm: loads the config and workload, fixes every setting the
+ *            schedule depends on, then runs each case with a trace file
+ *            and compares its dispatch order with the expected one
+ * Precondition: given config file name and optional meta data file name
+ * Postcondition: one line displayed per case, zero returned if every
+ *                order matched
+ * Exceptions: unreadable config or workload, or a failed run, is
+ *             reported and nonzero returned
+ * Notes: the config file supplies only settings left unchecked
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    ConfigDataType *configPtr = NULL;
+    OpCodeType *metaDataPtr = NULL;
+    char *workloadName = SCHED_CHECK_WORKLOAD;
+    char traceName[] = SCHED_CHECK_TRACE;
+    char errorMsg[ MAX_STR_LEN ];
+    char orderStr[ MAX_ORDER_LEN ];
+    const SchedCase *casePtr;
+    SimResult result;
+    int caseIndex, fileDesc, numFailed = 0;
+    Boolean matched;
+
+    // check for config file argument
+    if (argc < 2)
+       {
+        fprintf(stderr, "Usage: %s <config file> [meta data file]\n",
+                                                                   argv[ 0 ]);
+        return 1;
+       }
+    if (argc > 2)
+       {
+        workloadName = argv[ 2 ];
+       }
+
+    // load config and workload
+    if (getConfigData(argv[ 1 ], &configPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        return 1;
+       }
+    if (getMetaData(workloadName, &metaDataPtr, errorMsg) == False)
+       {
+        fprintf(stderr, "%s\n", errorMsg);
+        clearConfigData(configPtr);
+        return 1;
+       }
+
+    // create trace file name
+    fileDesc = mkstemp(traceName);
+    if (fileDesc == -1)
+       {
+        fprintf(stderr, "Unable to create temporary trace file\n");
+        clearMetaDataList(metaDataPtr);
+        clearConfigData(configPtr);
+        return 1;
+       }
+    close(fileDesc);
+
+    // fix settings the schedule depends on, tracing and nothing else
+    setBenchConfig(configPtr, NULL);
+    copyString(configPtr->traceFileName, traceName);
+    configPtr->numCores = 1;
+    configPtr->procCycleRate = SCHED_CHECK_CYCLE_MS;
+    configPtr->ioCycleRate = SCHED_CHECK_CYCLE_MS;
+    configPtr->quantumCycles = SCHED_CHECK_QUANTUM;
+    configPtr->memAvailable = SCHED_CHECK_MEMORY;
+    configPtr->pageSize = 0;
+    configPtr->burstAlpha = 0.0;
+    configPtr->mlfqLevels = SCHED_CHECK_LEVELS;
+    configPtr->mlfqQuantumScale = SCHED_CHECK_SCALE;
+    configPtr->ioSchedCode = IO_SCHED_NONE_CODE;
+    configPtr->memFitCode = MEM_FIT_NONE_CODE;
+    configPtr->memCompaction = False;
+
+    // loop across cases
+    for (caseIndex = 0; caseIndex < NUM_SCHED_CASES; caseIndex++)
+       {
+        casePtr = &schedCases[ caseIndex ];
+        configPtr->cpuSchedCode = casePtr->schedCode;
+        configPtr->mlfqAgingTime = casePtr->agingTime;
+        if (runSimulation(configPtr, metaDataPtr, NULL, &result) == False
+            || readDispatchOrder(traceName, orderStr) == False)
+           {
+            fprintf(stderr, "%s: simulation did not complete\n",
+                                                         casePtr->caseName);
+            numFailed++;
+            continue;
+           }
+
+        // compare and display order
+        matched = strcmp(orderStr, casePtr->expectedOrder) == 0;
+        printf("%-12s %s\n", casePtr->caseName,
+                                       matched == True ? "ok" : "FAILED");
+        if (matched == False)
+           {
+            printf("   expected: %s\n   actual:   %s\n",
+                                        casePtr->expectedOrder, orderStr);
+            numFailed++;
+           }
+       }
+
+    // release trace, workload, and config
+    remove(traceName);
+    clearMetaDataList(metaDataPtr);
+    clearConfigData(configPtr);
+    return numFailed > 0 ? 1 : 0;
+   }
@@ -0,0 +1,100 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include "SimBatch.h"
+
+/*
+ * Tool: batch simulation driver
+ *
+ * Runs every config/meta data pair listed in a manifest as an independent
+ * simulation, several at a time, and writes a summary table. Manifest
+ * lines are
+ *    <config file> [<meta data file> | -] [<monitor output file>]
+ * where "-" keeps the meta data file named in the config; blank lines and
+ * lines starting with '#' are ignored. Each run's monitor display goes to
+ * its output file, or is discarded when none is given; log, trace, and
+ * metrics files are written as each config names them with the manifest
+ * line number inserted before the extension, so sim.lgf from line 3 is
+ * written as sim.3.lgf.
+ *
+ * Build from repository root, with the simulator's other sources except
+ * its main driver:
+ *    gcc -O2 -I. tools/SimBatchRun.c <simulator sources> -lpthread
+ * Usage: a.out <manifest file> [summary file | -] [concurrent simulations]
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: loads manifest, runs the batch, then writes its summary
+ * Precondition: given manifest file name, optional summary file name ("-"
+ *               for standard output), and optional number of simulations
+ *               to run at once (default one per processor)
+ * Postcondition: summary written, zero returned if every simulation
+ *                completed
+ * Exceptions: unreadable manifest or summary file reported and nonzero
+ *             returned
+ * Notes: none
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    SimBatch batch;
+    char errorMsg[ MAX_STR_LEN ];
+    FILE *outPtr = stdout;
+    int numThreads = 0;
+    int index, numFailed = 0;
+
+    // check for manifest argument
+    if (argc < 2)
+       {
+        printf("Usage: %s <manifest file> [summary file | -] "
+                                 "[concurrent simulations]\n", argv[ 0 ]);
+        return 1;
+       }
+
+    // load manifest
+    if (loadBatchManifest(&batch, argv[ 1 ], errorMsg) == False)
+       {
+        printf("%s\n", errorMsg);
+        return 1;
+       }
+
+    // open summary file, if named
+    if (argc > 2 && compareString(argv[ 2 ], "-") != STR_EQ)
+       {
+        outPtr = fopen(argv[ 2 ], "w");
+        if (outPtr == NULL)
+           {
+            printf("Unable to open summary file: %s\n", argv[ 2 ]);
+            clearBatch(&batch);
+            return 1;
+           }
+       }
+
+    // set concurrency, if given
+    if (argc > 3)
+       {
+        numThreads = atoi(argv[ 3 ]);
+       }
+
+    // run batch and write summary
+    runBatch(&batch, numThreads);
+    writeBatchSummary(&batch, outPtr);
+
+    // count simulations not completed
+    for (index = 0; index < batch.numEntries; index++)
+       {
+        if (batch.entries[ index ].result.completed == False)
+           {
+            numFailed++;
+           }
+       }
+
+    // close summary file and release batch
+    if (outPtr != stdout)
+       {
+        fclose(outPtr);
+       }
+    clearBatch(&batch);
+    return numFailed > 0;
+   }
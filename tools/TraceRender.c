@@ -0,0 +1,116 @@
+// header files
+#include <stdio.h>
+#include <string.h>
+#include "TraceEvents.h"
+
+// global constants
+#define MAX_RENDER_DEVICES 256
+#define UNKNOWN_DEVICE_NAME "(unknown device)"
+
+/*
+ * Tool: binary trace renderer
+ *
+ * Reads a trace written by the simulator (traceFileName in the config) and
+ * writes the same text the simulator would have written to its log file.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. tools/TraceRender.c TraceEvents.c -o TraceRender
+ * Usage: TraceRender <trace file> [text output file]
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: checks trace header, then reads records in order, collecting
+ *            device name definitions and rendering every other record
+ *            through formatEvent
+ * Precondition: given trace file name and optional output file name
+ * Postcondition: rendered text written to output file or standard output,
+ *                zero returned on success
+ * Exceptions: malformed trace reported and nonzero returned
+ * Notes: a record whose device id is TRACE_NO_DEVICE, out of range, or
+ *        never defined is rendered with a placeholder device name
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    char deviceNames[ MAX_RENDER_DEVICES ][ STD_STR_LEN ] = { { NULL_CHAR } };
+    char magic[ TRACE_MAGIC_LEN ];
+    char timeStr[ STD_STR_LEN ];
+    char outputStr[ MAX_EVENT_LINE_LEN ];
+    char *deviceName;
+    TraceRecord record;
+    FILE *tracePtr, *outPtr = stdout;
+    int version;
+
+    // check for trace file argument
+    if (argc < 2)
+       {
+        printf("Usage: %s <trace file> [text output file]\n", argv[ 0 ]);
+        return 1;
+       }
+
+    // open trace and check header
+    tracePtr = fopen(argv[ 1 ], "rb");
+    if (tracePtr == NULL
+        || fread(magic, 1, TRACE_MAGIC_LEN, tracePtr) != TRACE_MAGIC_LEN
+        || memcmp(magic, TRACE_MAGIC, TRACE_MAGIC_LEN) != 0
+        || fread(&version, sizeof(int), 1, tracePtr) != 1
+        || version != TRACE_VERSION)
+       {
+        printf("Unable to read trace file: %s\n", argv[ 1 ]);
+        return 1;
+       }
+
+    // open output file, if given
+    if (argc > 2)
+       {
+        outPtr = fopen(argv[ 2 ], "w");
+        if (outPtr == NULL)
+           {
+            printf("Unable to open output file: %s\n", argv[ 2 ]);
+            return 1;
+           }
+       }
+
+    // render records in order
+    while (fread(&record, sizeof(TraceRecord), 1, tracePtr) == 1)
+       {
+        // check for device name definition
+        if (record.eventCode == EVT_DEVICE_NAME)
+           {
+            if (record.deviceId < 0 || record.deviceId >= MAX_RENDER_DEVICES
+                || record.eventArg < 0 || record.eventArg >= STD_STR_LEN
+                || fread(deviceNames[ record.deviceId ], 1,
+                     (size_t)record.eventArg, tracePtr)
+                                                 != (size_t)record.eventArg)
+               {
+                printf("Malformed device record in trace\n");
+                return 1;
+               }
+            deviceNames[ record.deviceId ][ record.eventArg ] = NULL_CHAR;
+           }
+
+        // otherwise, render event line
+        else
+           {
+            deviceName = UNKNOWN_DEVICE_NAME;
+            if (record.deviceId >= 0 && record.deviceId < MAX_RENDER_DEVICES
+                      && deviceNames[ record.deviceId ][ 0 ] != NULL_CHAR)
+               {
+                deviceName = deviceNames[ record.deviceId ];
+               }
+            sprintf(timeStr, TRACE_TIME_FORMAT, record.eventTime);
+            formatEvent(outputStr, timeStr, record.eventCode, record.pid,
+                                                 deviceName, record.eventArg);
+            fputs(outputStr, outPtr);
+           }
+       }
+
+    // close files and return success
+    fclose(tracePtr);
+    if (outPtr != stdout)
+       {
+        fclose(outPtr);
+       }
+    return 0;
+   }
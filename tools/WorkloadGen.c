@@ -0,0 +1,127 @@
+// header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "Workload.h"
+
+/*
+ * Tool: synthetic workload generator
+ *
+ * Writes a meta data file of generated processes. Each process runs a
+ * fixed number of ops whose kinds are drawn by the cpu:in:out:mem weights
+ * and whose cycle counts are drawn from the cycle range. A process's first
+ * memory op allocates one segment; later ones access it sequentially,
+ * at random, or mostly within its first tenth ("hot"). The same options
+ * and seed always produce the same file. Processes all arrive at time
+ * zero, or with -A as a Poisson stream of that many processes per second,
+ * for open-system runs. The memory every allocation needs is reported so
+ * the config's memAvailable can be set to match.
+ *
+ * Build from repository root:
+ *    gcc -O2 -I. tools/WorkloadGen.c Workload.c StringUtils.c
+ *                                                      -o WorkloadGen -lm
+ * Usage: WorkloadGen [-p processes] [-n ops per process]
+ *                    [-m cpu:in:out:mem] [-c min cycles] [-C max cycles]
+ *                    [-a seq|rand|hot] [-s segment size] [-z access size]
+ *                    [-A arrivals per second] [-r seed] <meta data file>
+ */
+
+/*
+ * Function Name: main
+ * Algorithm: reads options into a workload spec, checks it, then writes
+ *            the meta data file
+ * Precondition: given options and output file name
+ * Postcondition: meta data file written, zero returned on success
+ * Exceptions: bad option or unwritable file reported and nonzero returned
+ * Notes: none
+ */
+int main(int argc, char **argv)
+   {
+    // initialize function/variables
+    WorkloadSpec spec;
+    Boolean validSpec = True;
+    int option;
+
+    // read options
+    initWorkloadSpec(&spec);
+    while ((option = getopt(argc, argv, "p:n:m:c:C:a:s:z:A:r:")) != -1)
+       {
+        switch (option)
+           {
+           case 'p':
+              spec.numProcs = atoi(optarg);
+              break;
+
+           case 'n':
+              spec.opsPerProc = atoi(optarg);
+              break;
+
+           case 'm':
+              validSpec = validSpec && parseOpMix(optarg, &spec);
+              break;
+
+           case 'c':
+              spec.minCycles = atoi(optarg);
+              break;
+
+           case 'C':
+              spec.maxCycles = atoi(optarg);
+              break;
+
+           case 'a':
+              validSpec = validSpec && parseMemPattern(optarg, &spec);
+              break;
+
+           case 's':
+              spec.segmentSize = atoi(optarg);
+              break;
+
+           case 'z':
+              spec.accessSize = atoi(optarg);
+              break;
+
+           case 'A':
+              spec.arrivalRate = atof(optarg);
+              break;
+
+           case 'r':
+              spec.seed = (unsigned int)strtoul(optarg, NULL, 10);
+              break;
+
+           default:
+              validSpec = False;
+              break;
+           }
+       }
+
+    // check for missing file name or out of range values
+    if (validSpec == False || optind != argc - 1 || spec.numProcs < 1
+                  || spec.opsPerProc < 1 || spec.minCycles < 1
+                  || spec.maxCycles < spec.minCycles
+                  || spec.segmentSize < 1 || spec.accessSize < 1
+                  || spec.arrivalRate < 0.0)
+       {
+        fprintf(stderr, "Usage: %s [-p processes] [-n ops per process]\n"
+                  "          [-m cpu:in:out:mem] [-c min cycles] "
+                  "[-C max cycles]\n"
+                  "          [-a seq|rand|hot] [-s segment size] "
+                  "[-z access size]\n"
+                  "          [-A arrivals per second] [-r seed] "
+                  "<meta data file>\n", argv[ 0 ]);
+        return 1;
+       }
+
+    // write workload
+    if (writeWorkload(argv[ optind ], &spec) == False)
+       {
+        fprintf(stderr, "Unable to write meta data file: %s\n",
+                                                           argv[ optind ]);
+        return 1;
+       }
+
+    // report memory needed
+    printf("Wrote %d processes of %d ops to %s (memAvailable >= %d)\n",
+                    spec.numProcs, spec.opsPerProc, argv[ optind ],
+                                                     workloadMemory(&spec));
+    return 0;
+   }